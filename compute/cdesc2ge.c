@@ -0,0 +1,77 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zdesc2ge.c, normal z -> c, Sat Oct 17 13:39:11 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+
+/***************************************************************************//**
+    @ingroup plasma_ccrb2cm
+
+    Convert tiled (CCRB) to column-major (CM) matrix layout.
+    Out-of-place, unless A was created in-place
+    by plasma_desc_general_inplace_create() on pA.
+*/
+void plasma_omp_cdesc2ge(plasma_desc_t A,
+                         plasma_complex32_t *pA, int lda,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (pA == NULL) {
+        plasma_error("NULL A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (A.inplace && (A.matrix != pA || lda != A.gm)) {
+        plasma_error("in-place A does not alias pA");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.m == 0 || A.n == 0)
+        return;
+
+    // Call the parallel function.
+    if (A.inplace)
+        plasma_pdesc2ge_inplace(A, sequence, request);
+    else
+        plasma_pcdesc2ge(A, pA, lda, sequence, request);
+}
@@ -0,0 +1,285 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgesv.c, normal z -> c, Sat Oct 17 13:39:00 2026
+ *
+ **/
+
+#include "flops.h"
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_future.h"
+#include "plasma_internal.h"
+#include "plasma_tuning.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ ******************************************************************************/
+int plasma_cgesv(int n, int nrhs,
+                 plasma_complex32_t *pA, int lda, int *ipiv,
+                 plasma_complex32_t *pB, int ldb)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -2;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -7;
+    }
+
+    // quick return
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Time the call.
+    float stats = plasma_stats_start();
+
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune_getrf(plasma, PlasmaComplexFloat, n, n);
+
+    // Small problems skip tiling, the right-hand sides split over a team.
+    if (plasma_context_small(plasma, n)) {
+        int info = LAPACKE_cgetrf_work(LAPACK_COL_MAJOR, n, n, pA, lda, ipiv);
+        if (info != 0) {
+            plasma_stats_stop("cgesv",
+                              flops_cgetrf(n, n)+flops_cgetrs(n, nrhs), stats);
+            return info;
+        }
+
+        int team = imin(plasma->small_threads, nrhs);
+        #pragma omp parallel num_threads(team) if (team > 1)
+        {
+            int size = omp_get_num_threads();
+            int rank = omp_get_thread_num();
+            int j0 = nrhs*rank/size;
+            int jn = nrhs*(rank+1)/size-j0;
+            LAPACKE_cgetrs_work(LAPACK_COL_MAJOR, 'N', n, jn, pA, lda, ipiv,
+                                &pB[(size_t)ldb*j0], ldb);
+        }
+        plasma_stats_stop("cgesv",
+                          flops_cgetrf(n, n)+flops_cgetrs(n, nrhs), stats);
+        return PlasmaSuccess;
+    }
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Initialize barrier.
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
+
+    // Create tile matrix.
+    plasma_desc_t A;
+    plasma_desc_t B;
+    int retval;
+    retval = plasma_desc_general_inplace_create(PlasmaComplexFloat, pA, lda,
+                                                nb, nb, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_inplace_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_inplace_create(PlasmaComplexFloat, pB, ldb,
+                                                nb, nb, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_inplace_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    retval = plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    retval = plasma_request_init(&request);
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        // Translate to tile layout.
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_cge2desc(pB, ldb, B, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_cgesv(A, ipiv, B, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_cdesc2ge(A, pA, lda, &sequence, &request);
+        plasma_omp_cdesc2ge(B, pB, ldb, &sequence, &request);
+    }
+
+    // Free matrix A in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+
+    // Return status.
+    int status = sequence.status;
+    plasma_stats_stop("cgesv", flops_cgetrf(n, n)+flops_cgetrs(n, nrhs), stats);
+    return status;
+}
+
+/******************************************************************************/
+// Arguments of plasma_cgesv() queued by plasma_cgesv_async().
+typedef struct {
+    int n;
+    int nrhs;
+    plasma_complex32_t *pA;
+    int lda;
+    int *ipiv;
+    plasma_complex32_t *pB;
+    int ldb;
+} plasma_cgesv_args_t;
+
+/******************************************************************************/
+static int plasma_cgesv_run(void *args)
+{
+    plasma_cgesv_args_t *a = (plasma_cgesv_args_t*)args;
+    return plasma_cgesv(a->n, a->nrhs, a->pA, a->lda, a->ipiv, a->pB, a->ldb);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gesv
+ *
+ *  Asynchronous version of plasma_cgesv().
+ *  Returns once the call is queued. The solve runs on a thread and
+ *  OpenMP team owned by PLASMA, with the settings of the calling thread's
+ *  context at the time of the call, so the caller can go on preparing
+ *  the next system. A, ipiv and B must not be accessed until the call
+ *  completes.
+ *
+ *******************************************************************************
+ *
+ * @param[in] callback
+ *          Called with the return value of plasma_cgesv() when the solve
+ *          completes, before the future completes. May be NULL.
+ *
+ * @param[in] data
+ *          Passed to callback.
+ *
+ * @param[out] future
+ *          On exit, the future of the call. Its completion is checked by
+ *          plasma_future_test() and plasma_future_wait(), which returns the
+ *          return value of plasma_cgesv(). Freed by plasma_future_destroy().
+ *
+ *  The other arguments are the ones of plasma_cgesv().
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess if the call was queued
+ * @retval  < 0 if it could not be queued
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_cgesv
+ * @sa plasma_future_wait
+ *
+ ******************************************************************************/
+int plasma_cgesv_async(int n, int nrhs,
+                       plasma_complex32_t *pA, int lda, int *ipiv,
+                       plasma_complex32_t *pB, int ldb,
+                       plasma_callback_t callback, void *data,
+                       plasma_future_t **future)
+{
+    plasma_cgesv_args_t *args =
+        (plasma_cgesv_args_t*)malloc(sizeof(plasma_cgesv_args_t));
+    if (args == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    args->n = n;
+    args->nrhs = nrhs;
+    args->pA = pA;
+    args->lda = lda;
+    args->ipiv = ipiv;
+    args->pB = pB;
+    args->ldb = ldb;
+
+    return plasma_future_submit(plasma_cgesv_run, args, callback, data, future);
+}
+
+/***************************************************************************//**
+ *
+ ******************************************************************************/
+void plasma_omp_cgesv(plasma_desc_t A, int *ipiv,
+                      plasma_desc_t B,
+                      plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        plasma_error("invalid A");
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        plasma_error("invalid B");
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.n == 0 || B.n == 0)
+        return;
+
+    // Call the parallel functions.
+    plasma_pcgetrf(A, ipiv, sequence, request);
+
+    plasma_pcgeswp(PlasmaRowwise, B, ipiv, 1, sequence, request);
+
+    plasma_pctrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                  1.0, A,
+                       B,
+                  sequence, request);
+
+    plasma_pctrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                  1.0, A,
+                       B,
+                  sequence, request);
+}
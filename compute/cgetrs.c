@@ -0,0 +1,313 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgetrs.c, normal z -> c, Sat Oct 17 13:39:01 2026
+ *
+ **/
+
+#include "flops.h"
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_tuning.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ ******************************************************************************/
+int plasma_cgetrs(plasma_enum_t trans, int n, int nrhs,
+                  plasma_complex32_t *pA, int lda, int *ipiv,
+                  plasma_complex32_t *pB, int ldb)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    if ((trans != PlasmaNoTrans) &&
+        (trans != PlasmaTrans) &&
+        (trans != PlasmaConjTrans)) {
+        plasma_error("illegal value of trans");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -2;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -7;
+    }
+
+    // quick return
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Time the call.
+    float stats = plasma_stats_start();
+
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune_trsm(plasma, PlasmaComplexFloat, n, n);
+
+    // Small problems skip tiling, the right-hand sides split over a team.
+    if (plasma_context_small(plasma, n)) {
+        int team = imin(plasma->small_threads, nrhs);
+        #pragma omp parallel num_threads(team) if (team > 1)
+        {
+            int size = omp_get_num_threads();
+            int rank = omp_get_thread_num();
+            int j0 = nrhs*rank/size;
+            int jn = nrhs*(rank+1)/size-j0;
+            LAPACKE_cgetrs_work(LAPACK_COL_MAJOR, lapack_const(trans),
+                                n, jn, pA, lda, ipiv,
+                                &pB[(size_t)ldb*j0], ldb);
+        }
+        plasma_stats_stop("cgetrs", flops_cgetrs(n, nrhs), stats);
+        return PlasmaSuccess;
+    }
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Initialize barrier.
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
+
+    // Create tile matrix.
+    plasma_desc_t A;
+    plasma_desc_t B;
+    int retval;
+    retval = plasma_desc_general_inplace_create(PlasmaComplexFloat, pA, lda,
+                                                nb, nb, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_inplace_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_inplace_create(PlasmaComplexFloat, pB, ldb,
+                                                nb, nb, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_inplace_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    retval = plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    retval = plasma_request_init(&request);
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        // Translate to tile layout.
+        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_cge2desc(pB, ldb, B, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_cgetrs(trans, A, ipiv, B, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_cdesc2ge(B, pB, ldb, &sequence, &request);
+        if (A.inplace)
+            plasma_omp_cdesc2ge(A, pA, lda, &sequence, &request);
+    }
+
+    // Free matrix A in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+
+    // Return status.
+    int status = sequence.status;
+    plasma_stats_stop("cgetrs", flops_cgetrs(n, nrhs), stats);
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ ******************************************************************************/
+void plasma_omp_cgetrs(plasma_enum_t trans, plasma_desc_t A, int *ipiv,
+                       plasma_desc_t B,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if ((trans != PlasmaNoTrans) &&
+        (trans != PlasmaTrans) &&
+        (trans != PlasmaConjTrans)) {
+        plasma_error("illegal value of trans");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        plasma_error("invalid A");
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        plasma_error("invalid B");
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.n == 0 || B.n == 0)
+        return;
+
+    // Call the parallel functions.
+    if (trans == PlasmaNoTrans) {
+        plasma_pcgeswp(PlasmaRowwise, B, ipiv, 1, sequence, request);
+
+        plasma_pctrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                      1.0, A,
+                      B,
+                      sequence, request);
+        plasma_pctrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                      1.0, A,
+                      B,
+                      sequence, request);
+    }
+    else {
+        plasma_pctrsm(PlasmaLeft, PlasmaUpper, trans, PlasmaNonUnit,
+                      1.0, A,
+                      B,
+                      sequence, request);
+
+        plasma_pctrsm(PlasmaLeft, PlasmaLower, trans, PlasmaUnit,
+                      1.0, A,
+                      B,
+                      sequence, request);
+        plasma_pcgeswp(PlasmaRowwise, B, ipiv, -1, sequence, request);
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrs
+ *
+ *  Solves a system of linear equations using the LU factorization held by
+ *  a persistent handle, as computed by plasma_cgetrf_handle. The factors are
+ *  used in tile layout directly, so repeated solves do not translate A.
+ *
+ ******************************************************************************/
+int plasma_cgetrs_handle(plasma_enum_t trans, plasma_handle_t *A, int *ipiv,
+                         int nrhs, plasma_complex32_t *pB, int ldb)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((trans != PlasmaNoTrans) &&
+        (trans != PlasmaTrans) &&
+        (trans != PlasmaConjTrans)) {
+        plasma_error("illegal value of trans");
+        return -1;
+    }
+    if (plasma_handle_check(A, PlasmaComplexFloat) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -2;
+    }
+    int n = A->A.n;
+    if (A->A.m != n) {
+        plasma_error("A is not square");
+        return -2;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -4;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -6;
+    }
+
+    // quick return
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Use the tile size of the handle.
+    int nb = A->A.nb;
+
+    // Create tile matrix.
+    plasma_desc_t B;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        n, nrhs, 0, 0, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    retval = plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    retval = plasma_request_init(&request);
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        // Translate to tile layout.
+        plasma_omp_handle_to_tile(A, &sequence, &request);
+        plasma_omp_cge2desc(pB, ldb, B, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_cgetrs(trans, A->A, ipiv, B, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_cdesc2ge(B, pB, ldb, &sequence, &request);
+    }
+
+    // Free matrix B in tile layout.
+    plasma_desc_destroy(&B);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
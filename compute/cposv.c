@@ -0,0 +1,415 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zposv.c, normal z -> c, Sat Oct 17 13:39:09 2026
+ *
+ **/
+
+#include "flops.h"
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_future.h"
+#include "plasma_internal.h"
+#include "plasma_tuning.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <omp.h>
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_posv
+ *
+ *  Computes the solution to a system of linear equations A * X = B,
+ *  where A is an n-by-n Hermitian positive definite matrix and X and B are
+ *  n-by-nrhs matrices. The Cholesky decomposition is used to factor A as
+ *
+ *    \f[ A =  L\times L^H, \f] if uplo = PlasmaLower,
+ *    or
+ *    \f[ A =  U^H\times U, \f] if uplo = PlasmaUpper,
+ *
+ *  where U is an upper triangular matrix and  L is a lower triangular matrix.
+ *  The factored form of A is then used to solve the system of equations:
+ *
+ *   A * X = B.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in] n
+ *          The number of linear equations, i.e., the order of the matrix A.
+ *          n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of columns
+ *          of the matrix B.  nrhs >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the Hermitian positive definite matrix A.
+ *          If uplo = PlasmaUpper, the leading n-by-n upper triangular part of A
+ *          contains the upper triangular part of the matrix A, and the strictly
+ *          lower triangular part of A is not referenced.
+ *          If UPLO = 'L', the leading n-by-n lower triangular part of A
+ *          contains the lower triangular part of the matrix A, and the strictly
+ *          upper triangular part of A is not referenced.
+ *          On exit, if return value = 0, the factor U or L from
+ *          the Cholesky factorization  A = U^H*U or A = L*L^H.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in,out] pB
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, if return value = 0, the n-by-nrhs solution matrix X.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B. ldb >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval  > 0 if i, the leading minor of order i of A is not
+ *          positive definite, so the factorization could not
+ *          be completed, and the solution has not been computed.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_cposv
+ * @sa plasma_cposv
+ * @sa plasma_dposv
+ * @sa plasma_sposv
+ *
+ ******************************************************************************/
+int plasma_cposv(plasma_enum_t uplo,
+                 int n, int nrhs,
+                 plasma_complex32_t *pA, int lda,
+                 plasma_complex32_t *pB, int ldb)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -3;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -5;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -7;
+    }
+
+    // quick return
+    if (imin(n, nrhs) == 0)
+       return PlasmaSuccess;
+
+    // Time the call.
+    float stats = plasma_stats_start();
+
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune_potrf(plasma, PlasmaComplexFloat, n);
+
+    // Small problems skip tiling, the right-hand sides split over a team.
+    if (plasma_context_small(plasma, n)) {
+        int info = plasma_core_cpotrf(uplo, n, pA, lda);
+        if (info != 0) {
+            plasma_stats_stop("cposv",
+                              flops_cpotrf(n)+flops_cpotrs(n, nrhs), stats);
+            return info;
+        }
+
+        int team = imin(plasma->small_threads, nrhs);
+        #pragma omp parallel num_threads(team) if (team > 1)
+        {
+            int size = omp_get_num_threads();
+            int rank = omp_get_thread_num();
+            int j0 = nrhs*rank/size;
+            int jn = nrhs*(rank+1)/size-j0;
+            LAPACKE_cpotrs_work(LAPACK_COL_MAJOR, lapack_const(uplo),
+                                n, jn, pA, lda,
+                                &pB[(size_t)ldb*j0], ldb);
+        }
+        plasma_stats_stop("cposv",
+                          flops_cpotrf(n)+flops_cpotrs(n, nrhs), stats);
+        return PlasmaSuccess;
+    }
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t B;
+    int retval;
+    retval = plasma_desc_triangular_create(PlasmaComplexFloat, uplo, nb, nb,
+                                           n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_inplace_create(PlasmaComplexFloat, pB, ldb,
+                                                nb, nb, n, nrhs, &B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_inplace_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    retval = plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    retval = plasma_request_init(&request);
+
+    // asynchronous block
+    #pragma omp parallel
+    #pragma omp master
+    {
+        // Translate to tile layout.
+        plasma_omp_ctr2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_cge2desc(pB, ldb, B, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_cposv(uplo, A, B, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_cdesc2tr(A, pA, lda, &sequence, &request);
+        plasma_omp_cdesc2ge(B, pB, ldb, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+
+    // Return status.
+    int status = sequence.status;
+    plasma_stats_stop("cposv", flops_cpotrf(n)+flops_cpotrs(n, nrhs), stats);
+    return status;
+}
+
+/******************************************************************************/
+// Arguments of plasma_cposv() queued by plasma_cposv_async().
+typedef struct {
+    plasma_enum_t uplo;
+    int n;
+    int nrhs;
+    plasma_complex32_t *pA;
+    int lda;
+    plasma_complex32_t *pB;
+    int ldb;
+} plasma_cposv_args_t;
+
+/******************************************************************************/
+static int plasma_cposv_run(void *args)
+{
+    plasma_cposv_args_t *a = (plasma_cposv_args_t*)args;
+    return plasma_cposv(a->uplo, a->n, a->nrhs, a->pA, a->lda, a->pB, a->ldb);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_posv
+ *
+ *  Asynchronous version of plasma_cposv().
+ *  Returns once the call is queued. The solve runs on a thread and
+ *  OpenMP team owned by PLASMA, with the settings of the calling thread's
+ *  context at the time of the call. A and B must not be accessed until
+ *  the call completes.
+ *
+ *******************************************************************************
+ *
+ * @param[in] callback
+ *          Called with the return value of plasma_cposv() when the solve
+ *          completes, before the future completes. May be NULL.
+ *
+ * @param[in] data
+ *          Passed to callback.
+ *
+ * @param[out] future
+ *          On exit, the future of the call, as for plasma_cgesv_async().
+ *
+ *  The other arguments are the ones of plasma_cposv().
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess if the call was queued
+ * @retval  < 0 if it could not be queued
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_cposv
+ * @sa plasma_future_wait
+ *
+ ******************************************************************************/
+int plasma_cposv_async(plasma_enum_t uplo,
+                       int n, int nrhs,
+                       plasma_complex32_t *pA, int lda,
+                       plasma_complex32_t *pB, int ldb,
+                       plasma_callback_t callback, void *data,
+                       plasma_future_t **future)
+{
+    plasma_cposv_args_t *args =
+        (plasma_cposv_args_t*)malloc(sizeof(plasma_cposv_args_t));
+    if (args == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    args->uplo = uplo;
+    args->n = n;
+    args->nrhs = nrhs;
+    args->pA = pA;
+    args->lda = lda;
+    args->pB = pB;
+    args->ldb = ldb;
+
+    return plasma_future_submit(plasma_cposv_run, args, callback, data, future);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_posv
+ *
+ *  Solves a Hermitian positive definite system of linear equations
+ *  using Cholesky factorization.
+ *  Non-blocking tile version of plasma_cposv().
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in,out] A
+ *          On entry, the Hermitian positive definite matrix A.
+ *          If uplo = PlasmaUpper, the leading n-by-n upper triangular part of A
+ *          contains the upper triangular part of the matrix A, and the strictly
+ *          lower triangular part of A is not referenced.
+ *          If UPLO = 'L', the leading n-by-n lower triangular part of A
+ *          contains the lower triangular part of the matrix A, and the strictly
+ *          upper triangular part of A is not referenced.
+ *          On exit, if return value = 0, the factor U or L from
+ *          the Cholesky factorization  A = U^H*U or A = L*L^H.
+ *
+ * @param[in,out] B
+ *          On entry, the n-by-nrhs right hand side matrix B.
+ *          On exit, if return value = 0, the n-by-nrhs solution matrix X.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_cposv
+ * @sa plasma_omp_cposv
+ * @sa plasma_omp_dposv
+ * @sa plasma_omp_sposv
+ *
+ ******************************************************************************/
+void plasma_omp_cposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
+                      plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        plasma_error("invalid A");
+        return;
+    }
+    if (plasma_desc_check(B) != PlasmaSuccess) {
+        plasma_error("invalid B");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.n == 0 || B.n == 0)
+        return;
+
+    // Call the parallel functions.
+    plasma_pcpotrf(uplo, A, sequence, request);
+
+    plasma_enum_t trans;
+    trans = uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans;
+    plasma_pctrsm(PlasmaLeft, uplo, trans, PlasmaNonUnit,
+                  1.0, A,
+                       B,
+                  sequence, request);
+
+    trans = uplo == PlasmaUpper ? PlasmaNoTrans : PlasmaConjTrans;
+    plasma_pctrsm(PlasmaLeft, uplo, trans, PlasmaNonUnit,
+                  1.0, A,
+                       B,
+                  sequence, request);
+}
@@ -0,0 +1,294 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgemm_batch.c, normal z -> d, Sat Oct 17 13:39:38 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+
+#include <omp.h>
+
+/******************************************************************************/
+// Multiplies the matrices of the batch, the sizes of product i being
+// m[i*inc], n[i*inc], k[i*inc], lda[i*inc], ldb[i*inc] and ldc[i*inc],
+// i.e., inc = 0 for batches of products of the same size.
+static int plasma_dgemm_batch_run(plasma_enum_t transa, plasma_enum_t transb,
+                                  const int *m, const int *n, const int *k,
+                                  int inc,
+                                  double alpha,
+                                  double **pA, const int *lda,
+                                  double **pB, const int *ldb,
+                                  double beta,
+                                  double **pC, const int *ldc,
+                                  int batch_count)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((transa != PlasmaNoTrans) &&
+        (transa != PlasmaTrans) &&
+        (transa != PlasmaConjTrans)) {
+        plasma_error("illegal value of transa");
+        return -1;
+    }
+    if ((transb != PlasmaNoTrans) &&
+        (transb != PlasmaTrans) &&
+        (transb != PlasmaConjTrans)) {
+        plasma_error("illegal value of transb");
+        return -2;
+    }
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -14;
+    }
+    int num_sizes = inc == 0 ? 1 : batch_count;
+    if (num_sizes > 0 &&
+        (m == NULL || n == NULL || k == NULL ||
+         lda == NULL || ldb == NULL || ldc == NULL)) {
+        plasma_error("NULL sizes");
+        return PlasmaErrorNullParameter;
+    }
+    for (int i = 0; i < num_sizes; i++) {
+        if (m[i] < 0) {
+            plasma_error("illegal value of m");
+            return -3;
+        }
+        if (n[i] < 0) {
+            plasma_error("illegal value of n");
+            return -4;
+        }
+        if (k[i] < 0) {
+            plasma_error("illegal value of k");
+            return -5;
+        }
+        int am = transa == PlasmaNoTrans ? m[i] : k[i];
+        int bm = transb == PlasmaNoTrans ? k[i] : n[i];
+        if (lda[i] < imax(1, am)) {
+            plasma_error("illegal value of lda");
+            return -8;
+        }
+        if (ldb[i] < imax(1, bm)) {
+            plasma_error("illegal value of ldb");
+            return -10;
+        }
+        if (ldc[i] < imax(1, m[i])) {
+            plasma_error("illegal value of ldc");
+            return -13;
+        }
+    }
+    if (batch_count > 0 && (pA == NULL || pB == NULL || pC == NULL)) {
+        plasma_error("NULL pointer array");
+        return pA == NULL ? -7 : pB == NULL ? -9 : -12;
+    }
+
+    // quick return
+    if (batch_count == 0)
+        return PlasmaSuccess;
+
+    // Each product is computed by one task, a few tasks per thread
+    // balancing products of different sizes.
+    #pragma omp parallel
+    #pragma omp master
+    {
+        #pragma omp taskloop num_tasks(imin(batch_count, \
+                                            8*omp_get_num_threads()))
+        for (int i = 0; i < batch_count; i++) {
+            plasma_core_dgemm(transa, transb,
+                              m[i*inc], n[i*inc], k[i*inc],
+                              alpha, pA[i], lda[i*inc],
+                                     pB[i], ldb[i*inc],
+                              beta,  pC[i], ldc[i*inc]);
+        }
+    }
+    // implicit synchronization
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gemm
+ *
+ *  Performs a batch of matrix-matrix operations of the same size,
+ *
+ *    \f[ C_i = \alpha [op( A_i )\times op( B_i )] + \beta C_i, \f]
+ *
+ *  in LAPACK layout, in one parallel region, each product by a task.
+ *  Suited to large numbers of small matrices.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A_i is not transposed,
+ *          - PlasmaTrans:     A_i is transposed,
+ *          - PlasmaConjTrans: A_i is conjugate transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   B_i is not transposed,
+ *          - PlasmaTrans:     B_i is transposed,
+ *          - PlasmaConjTrans: B_i is conjugate transposed.
+ *
+ * @param[in] m
+ *          The number of rows of the matrices op( A_i ) and C_i. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices op( B_i ) and C_i. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of op( A_i ) and rows of op( B_i ). k >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] pA
+ *          Array of batch_count pointers to the matrices A_i,
+ *          as in plasma_dgemm().
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrices A_i.
+ *
+ * @param[in] pB
+ *          Array of batch_count pointers to the matrices B_i.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the matrices B_i.
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] pC
+ *          Array of batch_count pointers to the matrices C_i.
+ *          On exit, overwritten by the results.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the matrices C_i. ldc >= max(1,m).
+ *
+ * @param[in] batch_count
+ *          The number of products. batch_count >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dgemm_vbatch
+ * @sa plasma_cgemm_batch
+ * @sa plasma_dgemm_batch
+ * @sa plasma_sgemm_batch
+ *
+ ******************************************************************************/
+int plasma_dgemm_batch(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       double alpha,
+                       double **pA, int lda,
+                       double **pB, int ldb,
+                       double beta,
+                       double **pC, int ldc,
+                       int batch_count)
+{
+    return plasma_dgemm_batch_run(transa, transb, &m, &n, &k, 0,
+                                  alpha, pA, &lda, pB, &ldb,
+                                  beta, pC, &ldc, batch_count);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gemm
+ *
+ *  Performs a batch of matrix-matrix operations of different sizes,
+ *  with the same transpositions and scalars.
+ *  Variable size version of plasma_dgemm_batch().
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A_i is not transposed,
+ *          - PlasmaTrans:     A_i is transposed,
+ *          - PlasmaConjTrans: A_i is conjugate transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   B_i is not transposed,
+ *          - PlasmaTrans:     B_i is transposed,
+ *          - PlasmaConjTrans: B_i is conjugate transposed.
+ *
+ * @param[in] m
+ *          Array of batch_count, the numbers of rows of op( A_i ) and C_i.
+ *
+ * @param[in] n
+ *          Array of batch_count, the numbers of columns of op( B_i )
+ *          and C_i.
+ *
+ * @param[in] k
+ *          Array of batch_count, the numbers of columns of op( A_i )
+ *          and rows of op( B_i ).
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] pA
+ *          Array of batch_count pointers to the matrices A_i.
+ *
+ * @param[in] lda
+ *          Array of batch_count, the leading dimensions of the matrices A_i.
+ *
+ * @param[in] pB
+ *          Array of batch_count pointers to the matrices B_i.
+ *
+ * @param[in] ldb
+ *          Array of batch_count, the leading dimensions of the matrices B_i.
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] pC
+ *          Array of batch_count pointers to the matrices C_i.
+ *
+ * @param[in] ldc
+ *          Array of batch_count, the leading dimensions of the matrices C_i.
+ *
+ * @param[in] batch_count
+ *          The number of products. batch_count >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dgemm_batch
+ * @sa plasma_cgemm_vbatch
+ * @sa plasma_dgemm_vbatch
+ * @sa plasma_sgemm_vbatch
+ *
+ ******************************************************************************/
+int plasma_dgemm_vbatch(plasma_enum_t transa, plasma_enum_t transb,
+                        const int *m, const int *n, const int *k,
+                        double alpha,
+                        double **pA, const int *lda,
+                        double **pB, const int *ldb,
+                        double beta,
+                        double **pC, const int *ldc,
+                        int batch_count)
+{
+    return plasma_dgemm_batch_run(transa, transb, m, n, k, 1,
+                                  alpha, pA, lda, pB, ldb,
+                                  beta, pC, ldc, batch_count);
+}
@@ -0,0 +1,199 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zpotrf_batch.c, normal z -> d, Sat Oct 17 13:39:36 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+
+#include <omp.h>
+
+/******************************************************************************/
+// Factors the matrices of the batch, the sizes of matrix i being n[i*inc]
+// and lda[i*inc], i.e., inc = 0 for batches of matrices of the same size.
+static int plasma_dpotrf_batch_run(plasma_enum_t uplo,
+                                   const int *n, int inc,
+                                   double **pA, const int *lda,
+                                   int batch_count, int *info)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -5;
+    }
+    int num_sizes = inc == 0 ? 1 : batch_count;
+    if (num_sizes > 0 && (n == NULL || lda == NULL)) {
+        plasma_error("NULL sizes");
+        return n == NULL ? -2 : -4;
+    }
+    for (int i = 0; i < num_sizes; i++) {
+        if (n[i] < 0) {
+            plasma_error("illegal value of n");
+            return -2;
+        }
+        if (lda[i] < imax(1, n[i])) {
+            plasma_error("illegal value of lda");
+            return -4;
+        }
+    }
+    if (batch_count > 0 && pA == NULL) {
+        plasma_error("NULL pA");
+        return -3;
+    }
+    if (batch_count > 0 && info == NULL) {
+        plasma_error("NULL info");
+        return -6;
+    }
+
+    // quick return
+    if (batch_count == 0)
+        return PlasmaSuccess;
+
+    // Each matrix is factored by one task, a few tasks per thread
+    // balancing matrices of different sizes.
+    #pragma omp parallel
+    #pragma omp master
+    {
+        #pragma omp taskloop num_tasks(imin(batch_count, \
+                                            8*omp_get_num_threads()))
+        for (int i = 0; i < batch_count; i++) {
+            info[i] = plasma_core_dpotrf(uplo, n[i*inc],
+                                         pA[i], lda[i*inc]);
+        }
+    }
+    // implicit synchronization
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the Cholesky factorizations of a batch of symmetric positive
+ *  definite matrices of the same size,
+ *
+ *    \f[ A_i = L_i \times L_i^T, \f]
+ *    or
+ *    \f[ A_i = U_i^T \times U_i, \f]
+ *
+ *  in LAPACK layout, in one parallel region, each factorization by a task.
+ *  Suited to large numbers of small matrices.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangles of the matrices are stored;
+ *          - PlasmaLower: Lower triangles of the matrices are stored.
+ *
+ * @param[in] n
+ *          The order of the matrices. n >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch_count pointers to the matrices, as in
+ *          plasma_dpotrf(). On exit, the factors U or L.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrices. lda >= max(1,n).
+ *
+ * @param[in] batch_count
+ *          The number of matrices. batch_count >= 0.
+ *
+ * @param[out] info
+ *          Array of batch_count. info[i] = 0 if A_i was factored,
+ *          or j > 0 if its leading minor of order j is not positive definite.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dpotrf_vbatch
+ * @sa plasma_cpotrf_batch
+ * @sa plasma_dpotrf_batch
+ * @sa plasma_spotrf_batch
+ *
+ ******************************************************************************/
+int plasma_dpotrf_batch(plasma_enum_t uplo, int n,
+                        double **pA, int lda,
+                        int batch_count, int *info)
+{
+    return plasma_dpotrf_batch_run(uplo, &n, 0, pA, &lda,
+                                   batch_count, info);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the Cholesky factorizations of a batch of symmetric positive
+ *  definite matrices of different sizes.
+ *  Variable size version of plasma_dpotrf_batch().
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangles of the matrices are stored;
+ *          - PlasmaLower: Lower triangles of the matrices are stored.
+ *
+ * @param[in] n
+ *          Array of batch_count, the orders of the matrices. n[i] >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch_count pointers to the matrices.
+ *          On exit, the factors U or L.
+ *
+ * @param[in] lda
+ *          Array of batch_count, the leading dimensions of the matrices.
+ *          lda[i] >= max(1,n[i]).
+ *
+ * @param[in] batch_count
+ *          The number of matrices. batch_count >= 0.
+ *
+ * @param[out] info
+ *          Array of batch_count, as in plasma_dpotrf_batch().
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_dpotrf_batch
+ * @sa plasma_cpotrf_vbatch
+ * @sa plasma_dpotrf_vbatch
+ * @sa plasma_spotrf_vbatch
+ *
+ ******************************************************************************/
+int plasma_dpotrf_vbatch(plasma_enum_t uplo, const int *n,
+                         double **pA, const int *lda,
+                         int batch_count, int *info)
+{
+    return plasma_dpotrf_batch_run(uplo, n, 1, pA, lda,
+                                   batch_count, info);
+}
@@ -0,0 +1,166 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgeqrf_static.c, normal z -> c, Sat Oct 17 13:39:36 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_static.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include <plasma_core_blas.h>
+
+#include <omp.h>
+
+#define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
+#define T(m, n) (plasma_complex32_t*)plasma_tile_addr(T, m, n)
+
+/******************************************************************************/
+typedef struct {
+    plasma_context_t *plasma;
+    plasma_desc_t A;
+    plasma_desc_t T;
+    plasma_workspace_t work;
+    plasma_sequence_t *sequence;
+    plasma_request_t *request;
+} plasma_pcgeqrf_static_args_t;
+
+/******************************************************************************/
+// Factors the tile columns owned by the thread, with a flat tree. The owner
+// of a column factors it as a panel, when its turn comes, and applies the
+// reflectors of the panels before, in order. Entry (m, k) of the progress
+// table flags the reflectors of tile (m, k) final, so that the updates of
+// the other columns are pipelined with the panel.
+static void plasma_pcgeqrf_static_worker(int rank, int size, void *arg)
+{
+    plasma_pcgeqrf_static_args_t *args = (plasma_pcgeqrf_static_args_t*)arg;
+    plasma_desc_t A = args->A;
+    plasma_desc_t T = args->T;
+    plasma_context_t *plasma = args->plasma;
+    plasma_static_grid_t grid = plasma_static_grid_1d(size);
+
+    // Set inner blocking from the T tile row-dimension.
+    int ib = T.mb;
+
+    // Workspaces of the thread running the rank.
+    plasma_complex32_t *W =
+        (plasma_complex32_t*)args->work.spaces[omp_get_thread_num()];
+
+    for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        int mvak = plasma_tile_mview(A, k);
+        int nvak = plasma_tile_nview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+
+        // panel
+        if (plasma_static_owner(grid, 0, k) == rank) {
+            uint64_t start = plasma_trace_start();
+            int info = plasma_core_cgeqrt(mvak, nvak, ib,
+                                          A(k, k), ldak,
+                                          T(k, k), T.mb,
+                                          W, W+nvak);
+            plasma_trace_stop("cgeqrt", A(k, k), mvak, nvak, start);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_cgeqrt() failed");
+                plasma_request_fail(args->sequence, args->request,
+                                    PlasmaErrorInternal);
+                plasma_static_abort(plasma);
+                return;
+            }
+            plasma_static_set(plasma, k, k, 1);
+
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                start = plasma_trace_start();
+                info = plasma_core_ctsqrt(mvam, nvak, ib,
+                                          A(k, k), ldak,
+                                          A(m, k), ldam,
+                                          T(m, k), T.mb,
+                                          W, W+nvak);
+                plasma_trace_stop("ctsqrt", A(m, k), mvam, nvak, start);
+                if (info != PlasmaSuccess) {
+                    plasma_error("core_ctsqrt() failed");
+                    plasma_request_fail(args->sequence, args->request,
+                                        PlasmaErrorInternal);
+                    plasma_static_abort(plasma);
+                    return;
+                }
+                plasma_static_set(plasma, m, k, 1);
+            }
+        }
+
+        // update
+        for (int n = k+1; n < A.nt; n++) {
+            if (plasma_static_owner(grid, 0, n) != rank)
+                continue;
+            int nvan = plasma_tile_nview(A, n);
+
+            // The reflectors in the strictly lower part of tile (k, k)
+            // are final, the panel only updates its upper part further.
+            if (plasma_static_wait(plasma, k, k, 1))
+                return;
+            uint64_t start = plasma_trace_start();
+            plasma_core_cunmqr(PlasmaLeft, Plasma_ConjTrans,
+                               mvak, nvan, imin(mvak, nvak), ib,
+                               A(k, k), ldak,
+                               T(k, k), T.mb,
+                               A(k, n), ldak,
+                               W, nvan);
+            plasma_trace_stop("cunmqr", A(k, n), mvak, nvan, start);
+
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                if (plasma_static_wait(plasma, m, k, 1))
+                    return;
+                start = plasma_trace_start();
+                plasma_core_ctsmqr(PlasmaLeft, Plasma_ConjTrans,
+                                   A.mb, nvan, mvam, nvan, nvak, ib,
+                                   A(k, n), ldak,
+                                   A(m, n), ldam,
+                                   A(m, k), ldam,
+                                   T(m, k), T.mb,
+                                   W, ib);
+                plasma_trace_stop("ctsmqr", A(m, n), mvam, nvan, start);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile QR factorization, statically scheduled.
+ *  Tile columns are mapped cyclically to the threads and each panel
+ *  is factored by the owner of its column.
+ * @see plasma_omp_cgeqrf
+ ******************************************************************************/
+void plasma_pcgeqrf_static(plasma_desc_t A, plasma_desc_t T,
+                           plasma_workspace_t work,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma_static_init(plasma, A.mt, A.nt) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    plasma_pcgeqrf_static_args_t args = {
+        plasma, A, T, work, sequence, request
+    };
+    plasma_static_run(plasma_pcgeqrf_static_worker, &args);
+
+    plasma_static_finalize(plasma);
+}
@@ -0,0 +1,175 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgetrf_static.c, normal z -> d, Sat Oct 17 13:39:35 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_static.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+
+#define A(m, n) (double*)plasma_tile_addr(A, m, n)
+
+/******************************************************************************/
+typedef struct {
+    plasma_context_t *plasma;
+    plasma_desc_t A;
+    int *ipiv;
+    plasma_sequence_t *sequence;
+    plasma_request_t *request;
+} plasma_pdgetrf_static_args_t;
+
+/******************************************************************************/
+// Factors the tile columns owned by the thread. The owner of a column
+// factors it as a panel, when its turn comes, and applies the updates of
+// the panels before, in order. Entry (0, k) of the progress table flags
+// panel k and its pivots final, entry (1, n) counts the panels applied to
+// column n, which read the panels.
+static void plasma_pdgetrf_static_worker(int rank, int size, void *arg)
+{
+    plasma_pdgetrf_static_args_t *args = (plasma_pdgetrf_static_args_t*)arg;
+    plasma_desc_t A = args->A;
+    int *ipiv = args->ipiv;
+    plasma_context_t *plasma = args->plasma;
+    plasma_static_grid_t grid = plasma_static_grid_1d(size);
+
+    int ib = plasma->ib;
+    int minmtnt = imin(A.mt, A.nt);
+
+    for (int k = 0; k < minmtnt; k++) {
+        int nvak = plasma_tile_nview(A, k);
+        int mvak = plasma_tile_mview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+
+        // panel
+        if (plasma_static_owner(grid, 0, k) == rank) {
+            int max_idx;
+            double max_val;
+            int info = 0;
+            plasma_barrier_t barrier;
+            plasma_barrier_init(&barrier, plasma->barrier_mode);
+
+            plasma_desc_t view =
+                plasma_desc_view(A,
+                                 k*A.mb, k*A.nb,
+                                 A.m-k*A.mb, nvak);
+            uint64_t start = plasma_trace_start();
+            plasma_core_dgetrf(view, &ipiv[k*A.mb], ib,
+                               0, 1,
+                               &max_idx, &max_val, &info,
+                               &barrier);
+            plasma_trace_stop("dgetrf", A(k, k), A.m-k*A.mb, nvak, start);
+            if (info != 0) {
+                plasma_request_fail(args->sequence, args->request,
+                                    k*A.mb+info);
+                plasma_static_abort(plasma);
+                return;
+            }
+            for (int i = k*A.mb+1; i <= imin(A.m, k*A.mb+nvak); i++)
+                ipiv[i-1] += k*A.mb;
+
+            plasma_static_set(plasma, 0, k, 1);
+        }
+
+        // update
+        for (int n = k+1; n < A.nt; n++) {
+            if (plasma_static_owner(grid, 0, n) != rank)
+                continue;
+            if (plasma_static_wait(plasma, 0, k, 1))
+                return;
+
+            int nvan = plasma_tile_nview(A, n);
+
+            // geswp
+            int k1 = k*A.mb+1;
+            int k2 = imin(k*A.mb+A.mb, A.m);
+            plasma_desc_t view =
+                plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+            uint64_t start = plasma_trace_start();
+            plasma_core_dgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+            plasma_trace_stop("dgeswp", A(0, n), A.m, nvan, start);
+
+            // trsm
+            start = plasma_trace_start();
+            plasma_core_dtrsm(PlasmaLeft, PlasmaLower,
+                              PlasmaNoTrans, PlasmaUnit,
+                              mvak, nvan,
+                              1.0, A(k, k), ldak,
+                                   A(k, n), ldak);
+            plasma_trace_stop("dtrsm", A(k, n), mvak, nvan, start);
+            // gemm
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                start = plasma_trace_start();
+                plasma_core_dgemm(
+                    PlasmaNoTrans, PlasmaNoTrans,
+                    mvam, nvan, A.nb,
+                    -1.0, A(m, k), ldam,
+                          A(k, n), ldak,
+                    1.0,  A(m, n), ldam);
+                plasma_trace_stop("dgemm", A(m, n), mvam, nvan, start);
+            }
+            plasma_static_set(plasma, 1, n, k+1);
+        }
+    }
+
+    // pivoting to the left, once the panels to the right are final
+    // and panel k is applied to all columns
+    for (int k = 0; k < minmtnt-1; k++) {
+        if (plasma_static_owner(grid, 0, k) != rank)
+            continue;
+        for (int j = k+1; j < minmtnt; j++)
+            if (plasma_static_wait(plasma, 0, j, 1))
+                return;
+        for (int n = k+1; n < A.nt; n++)
+            if (plasma_static_wait(plasma, 1, n, k+1))
+                return;
+
+        plasma_desc_t view =
+            plasma_desc_view(A, 0, k*A.nb, A.m, A.nb);
+        int k1 = (k+1)*A.mb+1;
+        int k2 = imin(A.m, A.n);
+        uint64_t start = plasma_trace_start();
+        plasma_core_dgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+        plasma_trace_stop("dgeswp", A(0, k), A.m, A.nb, start);
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile LU factorization with partial pivoting, statically
+ *  scheduled. Tile columns are mapped cyclically to the threads and
+ *  each panel is factored by the owner of its column.
+ * @see plasma_omp_dgetrf
+ ******************************************************************************/
+void plasma_pdgetrf_static(plasma_desc_t A, int *ipiv,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma_static_init(plasma, 2, A.nt) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    plasma_pdgetrf_static_args_t args = {
+        plasma, A, ipiv, sequence, request
+    };
+    plasma_static_run(plasma_pdgetrf_static_worker, &args);
+
+    plasma_static_finalize(plasma);
+}
@@ -0,0 +1,408 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgeqrf.c, normal z -> s, Sat Oct 17 13:39:16 2026
+ *
+ **/
+
+#include "flops.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_dag.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_tree.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include <plasma_core_blas.h>
+
+#include <omp.h>
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+#define T(m, n) (float*)plasma_tile_addr(T, m, n)
+
+/******************************************************************************/
+// Creates the task factoring tile (k, k).
+static void plasma_psgeqrf_geqrt(plasma_desc_t A, plasma_desc_t T, int k,
+                                 plasma_workspace_t work, int priority,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int ib = T.mb;
+    int mvak = plasma_tile_mview(A, k);
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    float *akk = A(k, k);
+    float *tkk = T(k, k);
+
+    #pragma omp task depend(inout:akk[0:ldak*nvak]) \
+                     depend(out:tkk[0:ib*nvak]) \
+                     priority(priority)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int tid = omp_get_thread_num();
+            float *tau = (float*)work.spaces[tid];
+            uint64_t start = plasma_trace_start();
+            int info = plasma_core_sgeqrt(mvak, nvak, ib,
+                                          akk, ldak,
+                                          tkk, T.mb,
+                                          tau, tau+nvak);
+            plasma_trace_stop("sgeqrt", akk, mvak, nvak, start);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_sgeqrt() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Creates the task applying the reflectors of tile (k, k) to tile (k, n).
+static void plasma_psgeqrf_unmqr(plasma_desc_t A, plasma_desc_t T,
+                                 int k, int n,
+                                 plasma_workspace_t work, int priority,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int ib = T.mb;
+    int mvak = plasma_tile_mview(A, k);
+    int nvak = plasma_tile_nview(A, k);
+    int nvan = plasma_tile_nview(A, n);
+    int ldak = plasma_tile_mmain(A, k);
+    int kk = imin(mvak, nvak);
+    float *akk = A(k, k);
+    float *tkk = T(k, k);
+    float *akn = A(k, n);
+
+    #pragma omp task depend(in:akk[0:ldak*kk]) \
+                     depend(in:tkk[0:ib*kk]) \
+                     depend(inout:akn[0:ldak*nvan]) \
+                     priority(priority)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int tid = omp_get_thread_num();
+            float *W = (float*)work.spaces[tid];
+            uint64_t start = plasma_trace_start();
+            int info = plasma_core_sormqr(PlasmaLeft, PlasmaTrans,
+                                          mvak, nvan, kk, ib,
+                                          akk, ldak,
+                                          tkk, T.mb,
+                                          akn, ldak,
+                                          W, nvan);
+            plasma_trace_stop("sormqr", akn, mvak, nvan, start);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_sormqr() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Creates the task annihilating tile (m, k) against tile (k, k).
+static void plasma_psgeqrf_tsqrt(plasma_desc_t A, plasma_desc_t T,
+                                 int k, int m,
+                                 plasma_workspace_t work, int priority,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int ib = T.mb;
+    int mvam = plasma_tile_mview(A, m);
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    int ldam = plasma_tile_mmain(A, m);
+    float *akk = A(k, k);
+    float *amk = A(m, k);
+    float *tmk = T(m, k);
+
+    #pragma omp task depend(inout:akk[0:ldak*nvak]) \
+                     depend(inout:amk[0:ldam*nvak]) \
+                     depend(out:tmk[0:ib*nvak]) \
+                     priority(priority)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int tid = omp_get_thread_num();
+            float *tau = (float*)work.spaces[tid];
+            uint64_t start = plasma_trace_start();
+            int info = plasma_core_stsqrt(mvam, nvak, ib,
+                                          akk, ldak,
+                                          amk, ldam,
+                                          tmk, T.mb,
+                                          tau, tau+nvak);
+            plasma_trace_stop("stsqrt", amk, mvam, nvak, start);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_stsqrt() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Creates the task applying the reflectors of tile (m, k)
+// to tiles (k, n) and (m, n).
+static void plasma_psgeqrf_tsmqr(plasma_desc_t A, plasma_desc_t T,
+                                 int k, int m, int n,
+                                 plasma_workspace_t work, int priority,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int ib = T.mb;
+    int mvam = plasma_tile_mview(A, m);
+    int nvak = plasma_tile_nview(A, k);
+    int nvan = plasma_tile_nview(A, n);
+    int ldak = plasma_tile_mmain(A, k);
+    int ldam = plasma_tile_mmain(A, m);
+    float *akn = A(k, n);
+    float *amn = A(m, n);
+    float *amk = A(m, k);
+    float *tmk = T(m, k);
+
+    #pragma omp task depend(inout:akn[0:ldak*nvan]) \
+                     depend(inout:amn[0:ldam*nvan]) \
+                     depend(in:amk[0:ldam*nvak]) \
+                     depend(in:tmk[0:ib*nvak]) \
+                     priority(priority)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int tid = omp_get_thread_num();
+            float *W = (float*)work.spaces[tid];
+            uint64_t start = plasma_trace_start();
+            int info = plasma_core_stsmqr(PlasmaLeft, PlasmaTrans,
+                                          A.mb, nvan, mvam, nvan, nvak, ib,
+                                          akn, ldak,
+                                          amn, ldam,
+                                          amk, ldam,
+                                          tmk, T.mb,
+                                          W, ib);
+            plasma_trace_stop("stsmqr", amn, mvam, nvan, start);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_stsmqr() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile QR factorization - dynamic scheduling
+ *  The tasks of the next PlasmaLookahead panels are prioritized.
+ * @see plasma_omp_sgeqrf
+ **/
+void plasma_psgeqrf(plasma_desc_t A, plasma_desc_t T,
+                    plasma_workspace_t work,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Panels come first, then the updates of the next la panels.
+    plasma_context_t *plasma = plasma_context_self();
+    int la = plasma->lookahead;
+
+    for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        plasma_psgeqrf_geqrt(A, T, k, work, la+1, sequence, request);
+
+        for (int n = k+1; n < A.nt; n++) {
+            plasma_psgeqrf_unmqr(A, T, k, n, work,
+                                 plasma_lookahead_priority(la, k, n),
+                                 sequence, request);
+        }
+        for (int m = k+1; m < A.mt; m++) {
+            plasma_psgeqrf_tsqrt(A, T, k, m, work, la+1, sequence, request);
+
+            for (int n = k+1; n < A.nt; n++) {
+                plasma_psgeqrf_tsmqr(A, T, k, m, n, work,
+                                     plasma_lookahead_priority(la, k, n),
+                                     sequence, request);
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Kernels of the task graph of a dry run. Tasks eliminate column k
+// in tile row m, and update tile (m, n).
+enum {
+    PlasmaGeqrfGeqrt,  // factors tile (m, k)
+    PlasmaGeqrfUnmqr,  // applies the reflectors of tile (m, k) to (m, n)
+    PlasmaGeqrfTsqrt,  // eliminates tile (m, k) with a triangle above it
+    PlasmaGeqrfTsmqr,  // applies the reflectors of the tsqrt to (m, n)
+    PlasmaGeqrfTtqrt,  // eliminates triangle (m, k) with a triangle above it
+    PlasmaGeqrfTtmqr   // applies the reflectors of the ttqrt to (m, n)
+};
+
+// Arguments of the described kernels of a dry run.
+typedef struct {
+    plasma_desc_t A;
+    int lookahead;
+    int tree;
+} plasma_psgeqrf_dryrun_args_t;
+
+/******************************************************************************/
+// Describes one task of a dry run, as plasma_psgeqrf() or
+// plasma_psgeqrf_tree() would create it. The triangle-on-square kernels
+// are costed as the QR of the stacked tiles without the triangle, and the
+// triangle-on-triangle ones as a third of the factorization and half of
+// the update.
+static void plasma_psgeqrf_describe(const plasma_dag_task_t *task, void *arg,
+                                    plasma_dag_info_t *info)
+{
+    plasma_psgeqrf_dryrun_args_t *args = (plasma_psgeqrf_dryrun_args_t*)arg;
+    plasma_desc_t A = args->A;
+    int la = args->lookahead;
+    int nvak = plasma_tile_nview(A, task->k);
+    int mvam = plasma_tile_mview(A, task->m);
+    int nvan = plasma_tile_nview(A, task->n);
+
+    float tsqrt = flops_sgeqrf(nvak+mvam, nvak)-flops_sgeqrf(nvak, nvak);
+    float tsmqr = flops_sormqr(PlasmaLeft, nvak+mvam, nvan, nvak)-
+                   flops_sormqr(PlasmaLeft, nvak, nvan, nvak);
+    int panel = args->tree ? 0 : la+1;
+    int update = args->tree ? 0 :
+                 plasma_lookahead_priority(la, task->k, task->n);
+
+    info->threads = 1;
+    switch (task->kernel) {
+    case PlasmaGeqrfGeqrt:
+        info->name = "sgeqrt";
+        info->flops = flops_sgeqrf(mvam, nvak);
+        info->priority = panel;
+        break;
+    case PlasmaGeqrfUnmqr:
+        info->name = "sormqr";
+        info->flops = flops_sormqr(PlasmaLeft, mvam, nvan, imin(mvam, nvak));
+        info->priority = update;
+        break;
+    case PlasmaGeqrfTsqrt:
+        info->name = "stsqrt";
+        info->flops = tsqrt;
+        info->priority = panel;
+        break;
+    case PlasmaGeqrfTsmqr:
+        info->name = "stsmqr";
+        info->flops = tsmqr;
+        info->priority = update;
+        break;
+    case PlasmaGeqrfTtqrt:
+        info->name = "sttqrt";
+        info->flops = tsqrt/3.0;
+        info->priority = panel;
+        break;
+    case PlasmaGeqrfTtmqr:
+        info->name = "sttmqr";
+        info->flops = tsmqr/2.0;
+        info->priority = update;
+        break;
+    }
+}
+
+/******************************************************************************/
+// Records the tasks of plasma_psgeqrf_tree(). Returns the error of
+// plasma_tree_operations().
+static int plasma_psgeqrf_tree_tasks(plasma_dag_t *dag, plasma_desc_t A)
+{
+    plasma_sequence_t sequence;
+    plasma_request_t request;
+    plasma_sequence_init(&sequence);
+    plasma_request_init(&request);
+
+    int *operations = NULL;
+    int num_operations;
+    plasma_tree_operations(A.mt, A.nt, &operations, &num_operations,
+                           &sequence, &request);
+    if (sequence.status != PlasmaSuccess)
+        return sequence.status;
+
+    for (int iop = 0; iop < num_operations; iop++) {
+        int j, k, kpiv;
+        plasma_enum_t kernel;
+        plasma_tree_get_operation(operations, iop, &kernel, &j, &k, &kpiv);
+
+        if (kernel == PlasmaGeKernel) {
+            plasma_dag_task(dag, PlasmaGeqrfGeqrt, j, k, j);
+            plasma_dag_access(dag, k, j, PlasmaDagInout);
+            for (int jj = j+1; jj < A.nt; jj++) {
+                plasma_dag_task(dag, PlasmaGeqrfUnmqr, j, k, jj);
+                plasma_dag_access(dag, k, j, PlasmaDagIn);
+                plasma_dag_access(dag, k, jj, PlasmaDagInout);
+            }
+        }
+        else {
+            int tt = kernel == PlasmaTtKernel;
+            plasma_dag_task(dag, tt ? PlasmaGeqrfTtqrt : PlasmaGeqrfTsqrt,
+                            j, k, j);
+            plasma_dag_access(dag, kpiv, j, PlasmaDagInout);
+            plasma_dag_access(dag, k, j, PlasmaDagInout);
+            for (int jj = j+1; jj < A.nt; jj++) {
+                plasma_dag_task(dag, tt ? PlasmaGeqrfTtmqr : PlasmaGeqrfTsmqr,
+                                j, k, jj);
+                plasma_dag_access(dag, kpiv, jj, PlasmaDagInout);
+                plasma_dag_access(dag, k, jj, PlasmaDagInout);
+                plasma_dag_access(dag, k, j, PlasmaDagIn);
+            }
+        }
+    }
+    free(operations);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *  Records the task graph of plasma_psgeqrf(), or of plasma_psgeqrf_tree()
+ *  with PlasmaTreeHouseholder, for plasma_dag_write(), without running it.
+ *  A needs no memory.
+ * @see plasma_omp_sgeqrf
+ ******************************************************************************/
+int plasma_psgeqrf_dryrun(plasma_desc_t A, int ib)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL)
+        return PlasmaErrorNotInitialized;
+
+    int tree = plasma->householder_mode == PlasmaTreeHouseholder;
+    plasma_dag_t *dag = plasma_dag_create(PlasmaDagGeqrf,
+                                          plasma->householder_mode,
+                                          A.mt, A.nt);
+    if (dag == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    if (tree) {
+        int retval = plasma_psgeqrf_tree_tasks(dag, A);
+        if (retval != PlasmaSuccess) {
+            plasma_dag_destroy(dag);
+            return retval;
+        }
+    }
+    else {
+        for (int k = 0; k < imin(A.mt, A.nt); k++) {
+            plasma_dag_task(dag, PlasmaGeqrfGeqrt, k, k, k);
+            plasma_dag_access(dag, k, k, PlasmaDagInout);
+            for (int n = k+1; n < A.nt; n++) {
+                plasma_dag_task(dag, PlasmaGeqrfUnmqr, k, k, n);
+                plasma_dag_access(dag, k, k, PlasmaDagIn);
+                plasma_dag_access(dag, k, n, PlasmaDagInout);
+            }
+            for (int m = k+1; m < A.mt; m++) {
+                plasma_dag_task(dag, PlasmaGeqrfTsqrt, k, m, k);
+                plasma_dag_access(dag, k, k, PlasmaDagInout);
+                plasma_dag_access(dag, m, k, PlasmaDagInout);
+                for (int n = k+1; n < A.nt; n++) {
+                    plasma_dag_task(dag, PlasmaGeqrfTsmqr, k, m, n);
+                    plasma_dag_access(dag, k, n, PlasmaDagInout);
+                    plasma_dag_access(dag, m, n, PlasmaDagInout);
+                    plasma_dag_access(dag, m, k, PlasmaDagIn);
+                }
+            }
+        }
+    }
+
+    plasma_psgeqrf_dryrun_args_t args = { A, plasma->lookahead, tree };
+    return plasma_dag_dryrun(dag, "sgeqrf", A.m, A.n, A.nb, ib,
+                             plasma_psgeqrf_describe, &args);
+}
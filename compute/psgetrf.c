@@ -0,0 +1,374 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgetrf.c, normal z -> s, Sat Oct 17 13:39:17 2026
+ *
+ **/
+
+#include "flops.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_dag.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include <plasma_core_blas.h>
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+
+/******************************************************************************/
+void plasma_psgetrf(plasma_desc_t A, int *ipiv,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+
+    // Set tiling parameters.
+    int ib = plasma->ib;
+
+    // Panels come first, then the updates of the next la panels.
+    int la = plasma->lookahead;
+
+    int minmtnt = imin(A.mt, A.nt);
+
+    for (int k = 0; k < minmtnt; k++) {
+        float *a00, *a20;
+        a00 = A(k, k);
+        a20 = A(A.mt-1, k);
+
+        // Create fake dependencies of the whole panel on its individual tiles.
+        // These tasks are inserted to generate a correct DAG rather than
+        // doing any useful work.
+        for (int m = k+1; m < A.mt-1; m++) {
+            float *amk = A(m, k);
+            #pragma omp task depend (in:amk[0]) \
+                             depend (inout:a00[0]) \
+                             priority(la+1)
+            {
+                // Do some funny work here. It appears so that the compiler
+                // might not insert the task if it is completely empty.
+                int l = 1;
+                l++;
+            }
+        }
+
+        int ma00k = (A.mt-k-1)*A.mb;
+        int na00k = plasma_tile_nmain(A, k);
+        int lda20 = plasma_tile_mmain(A, A.mt-1);
+
+        int nvak = plasma_tile_nview(A, k);
+        int mvak = plasma_tile_mview(A, k);
+        int ldak = plasma_tile_mmain(A, k);
+
+        int num_panel_threads = imin(plasma->max_panel_threads,
+                                     minmtnt-k);
+        // panel
+        #pragma omp task depend(inout:a00[0:ma00k*na00k]) \
+                         depend(inout:a20[0:lda20*nvak]) \
+                         depend(out:ipiv[k*A.mb:mvak]) \
+                         priority(la+1)
+        {
+            volatile int *max_idx = (int*)malloc(num_panel_threads*sizeof(int));
+            if (max_idx == NULL)
+                plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+
+            volatile float *max_val =
+                (float*)malloc(num_panel_threads*sizeof(
+                                            float));
+            if (max_val == NULL)
+                plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+
+            volatile int info = 0;
+
+            plasma_barrier_t barrier;
+            plasma_barrier_init(&barrier, plasma->barrier_mode);
+
+            if (sequence->status == PlasmaSuccess) {
+                // If nesting would not be expensive on architectures such as
+                // KNL, this would resolve the issue with deadlocks caused by
+                // tasks expected to run are in fact not launched.
+                //#pragma omp parallel for shared(barrier)
+                //                         schedule(dynamic,1)
+                //                         num_threads(num_panel_threads)
+                #pragma omp taskloop untied shared(barrier) \
+                                     num_tasks(num_panel_threads) \
+                                     priority(la+2)
+                for (int rank = 0; rank < num_panel_threads; rank++) {
+                    {
+                        uint64_t start = plasma_trace_start();
+                        plasma_desc_t view =
+                            plasma_desc_view(A,
+                                             k*A.mb, k*A.nb,
+                                             A.m-k*A.mb, nvak);
+
+                        plasma_core_sgetrf(view, &ipiv[k*A.mb], ib,
+                                    rank, num_panel_threads,
+                                    max_idx, max_val, &info,
+                                    &barrier);
+                        plasma_trace_stop("sgetrf", a00, A.m-k*A.mb, nvak,
+                                          start);
+
+                        if (info != 0)
+                            plasma_request_fail(sequence, request, k*A.mb+info);
+                    }
+                }
+            }
+            #pragma omp taskwait
+
+            free((void*)max_idx);
+            free((void*)max_val);
+
+            for (int i = k*A.mb+1; i <= imin(A.m, k*A.mb+nvak); i++)
+                ipiv[i-1] += k*A.mb;
+        }
+
+        // update
+        for (int n = k+1; n < A.nt; n++) {
+            float *a01, *a11, *a21;
+            a01 = A(k, n);
+            a11 = A(k+1, n);
+            a21 = A(A.mt-1, n);
+
+            int ma11k = (A.mt-k-2)*A.mb;
+            int na11n = plasma_tile_nmain(A, n);
+            int lda21 = plasma_tile_mmain(A, A.mt-1);
+
+            int nvan = plasma_tile_nview(A, n);
+            int priority = plasma_lookahead_priority(la, k, n);
+
+            // Create fake dependencies of the first update of the column
+            // on its individual tiles, as for the panel. The next updates
+            // of the column follow the first one.
+            if (k == 0) {
+                for (int m = k+2; m < A.mt-1; m++) {
+                    float *amn = A(m, n);
+                    #pragma omp task depend (in:amn[0]) \
+                                     depend (inout:a11[0]) \
+                                     priority(priority)
+                    {
+                        int l = 1;
+                        l++;
+                    }
+                }
+            }
+
+            #pragma omp task depend(in:a00[0:ma00k*na00k]) \
+                             depend(in:a20[0:lda20*nvak]) \
+                             depend(in:ipiv[k*A.mb:mvak]) \
+                             depend(inout:a01[0:ldak*nvan]) \
+                             depend(inout:a11[0:ma11k*na11n]) \
+                             depend(inout:a21[0:lda21*nvan]) \
+                             priority(priority)
+            {
+                if (sequence->status == PlasmaSuccess) {
+                    // geswp
+                    int k1 = k*A.mb+1;
+                    int k2 = imin(k*A.mb+A.mb, A.m);
+                    plasma_desc_t view =
+                        plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+                    uint64_t start = plasma_trace_start();
+                    plasma_core_sgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+                    plasma_trace_stop("sgeswp", A(0, n), A.m, nvan, start);
+
+                    // trsm
+                    start = plasma_trace_start();
+                    plasma_core_strsm(PlasmaLeft, PlasmaLower,
+                               PlasmaNoTrans, PlasmaUnit,
+                               mvak, nvan,
+                               1.0, A(k, k), ldak,
+                                    A(k, n), ldak);
+                    plasma_trace_stop("strsm", A(k, n), mvak, nvan, start);
+                    // gemm
+                    for (int m = k+1; m < A.mt; m++) {
+                        int mvam = plasma_tile_mview(A, m);
+                        int ldam = plasma_tile_mmain(A, m);
+
+                        #pragma omp task priority(priority)
+                        {
+                            uint64_t start = plasma_trace_start();
+                            plasma_core_sgemm(
+                                PlasmaNoTrans, PlasmaNoTrans,
+                                mvam, nvan, A.nb,
+                                -1.0, A(m, k), ldam,
+                                      A(k, n), ldak,
+                                1.0,  A(m, n), ldam);
+                            plasma_trace_stop("sgemm", A(m, n), mvam, nvan,
+                                              start);
+                        }
+                    }
+                }
+                #pragma omp taskwait
+            }
+        }
+    }
+
+    // Multidependency of the whole ipiv on the individual chunks
+    // corresponding to tiles.
+    for (int m = 0; m < minmtnt; m++) {
+        // insert dummy task
+        #pragma omp task depend (in:ipiv[m*A.mb]) \
+                         depend (inout:ipiv[0])
+        {
+            int l = 1;
+            l++;
+        }
+    }
+
+    // pivoting to the left
+    for (int k = 0; k < minmtnt-1; k++) {
+        float *a10, *a20;
+        a10 = A(k+1, k);
+        a20 = A(A.mt-1, k);
+
+        int ma10k = (A.mt-k-2)*A.mb;
+        int na00k = plasma_tile_nmain(A, k);
+        int lda20 = plasma_tile_mmain(A, A.mt-1);
+
+        int nvak = plasma_tile_nview(A, k);
+
+        #pragma omp task depend(in:ipiv[0:imin(A.m,A.n)]) \
+                         depend(inout:a10[0:ma10k*na00k]) \
+                         depend(inout:a20[0:lda20*nvak])
+        {
+            if (sequence->status == PlasmaSuccess) {
+                plasma_desc_t view =
+                    plasma_desc_view(A, 0, k*A.nb, A.m, A.nb);
+                int k1 = (k+1)*A.mb+1;
+                int k2 = imin(A.m, A.n);
+                plasma_core_sgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+            }
+        }
+
+        // Multidependency of individual tiles on the whole panel.
+        for (int m = k+2; m < A.mt-1; m++) {
+            float *amk = A(m, k);
+            #pragma omp task depend (in:a10[0]) \
+                             depend (inout:amk[0])
+            {
+                // Do some funny work here. It appears so that the compiler
+                // might not insert the task if it is completely empty.
+                int l = 1;
+                l++;
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Kernels of the task graph of a dry run.
+enum {
+    PlasmaGetrfPanel,   // factors panel k
+    PlasmaGetrfUpdate,  // swaps rows of column n and solves tile (k, n)
+    PlasmaGetrfGemm,    // updates tile (m, n)
+    PlasmaGetrfSwap     // swaps rows of column k to the left
+};
+
+// Arguments of the described kernels of a dry run.
+typedef struct {
+    plasma_desc_t A;
+    int lookahead;
+    int max_panel_threads;
+} plasma_psgetrf_dryrun_args_t;
+
+/******************************************************************************/
+// Describes one task of a dry run, as plasma_psgetrf() would create it.
+static void plasma_psgetrf_describe(const plasma_dag_task_t *task, void *arg,
+                                    plasma_dag_info_t *info)
+{
+    plasma_psgetrf_dryrun_args_t *args = (plasma_psgetrf_dryrun_args_t*)arg;
+    plasma_desc_t A = args->A;
+    int la = args->lookahead;
+    int k = task->k;
+    int mvak = plasma_tile_mview(A, k);
+    int nvak = plasma_tile_nview(A, k);
+    int mvam = plasma_tile_mview(A, task->m);
+    int nvan = plasma_tile_nview(A, task->n);
+
+    info->threads = 1;
+    switch (task->kernel) {
+    case PlasmaGetrfPanel:
+        info->name = "sgetrf";
+        info->flops = flops_sgetrf(A.m-k*A.mb, nvak);
+        info->priority = la+1;
+        info->threads = imin(args->max_panel_threads,
+                             imin(A.mt, A.nt)-k);
+        break;
+    case PlasmaGetrfUpdate:
+        info->name = "strsm";
+        info->flops = flops_strsm(PlasmaLeft, mvak, nvan);
+        info->priority = plasma_lookahead_priority(la, k, task->n);
+        break;
+    case PlasmaGetrfGemm:
+        info->name = "sgemm";
+        info->flops = flops_sgemm(mvam, nvan, A.nb);
+        info->priority = plasma_lookahead_priority(la, k, task->n);
+        break;
+    case PlasmaGetrfSwap:
+        info->name = "sgeswp";
+        info->flops = 0.0;
+        info->priority = 0;
+        break;
+    }
+}
+
+/***************************************************************************//**
+ *  Records the task graph of plasma_psgetrf() for plasma_dag_write(),
+ *  without running it. A needs no memory. The gemm tasks, nested in the
+ *  update of their column, are recorded as tasks of their own, and the
+ *  tasks adding dependences on whole panels are left out.
+ * @see plasma_omp_sgetrf
+ ******************************************************************************/
+int plasma_psgetrf_dryrun(plasma_desc_t A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL)
+        return PlasmaErrorNotInitialized;
+
+    plasma_dag_t *dag = plasma_dag_create(PlasmaDagGetrf, 0, A.mt, A.nt);
+    if (dag == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    int minmtnt = imin(A.mt, A.nt);
+    for (int k = 0; k < minmtnt; k++) {
+        plasma_dag_task(dag, PlasmaGetrfPanel, k, k, k);
+        for (int m = k; m < A.mt; m++)
+            plasma_dag_access(dag, m, k, PlasmaDagInout);
+
+        for (int n = k+1; n < A.nt; n++) {
+            plasma_dag_task(dag, PlasmaGetrfUpdate, k, k, n);
+            plasma_dag_access(dag, k, k, PlasmaDagIn);
+            for (int m = k; m < A.mt; m++)
+                plasma_dag_access(dag, m, n, PlasmaDagInout);
+
+            for (int m = k+1; m < A.mt; m++) {
+                plasma_dag_task(dag, PlasmaGetrfGemm, k, m, n);
+                plasma_dag_access(dag, m, k, PlasmaDagIn);
+                plasma_dag_access(dag, k, n, PlasmaDagIn);
+                plasma_dag_access(dag, m, n, PlasmaDagInout);
+            }
+        }
+    }
+    // The swaps to the left wait for the pivots of the last panel,
+    // which follows all the others.
+    for (int k = 0; k < minmtnt-1; k++) {
+        plasma_dag_task(dag, PlasmaGetrfSwap, k, k+1, k);
+        plasma_dag_access(dag, minmtnt-1, minmtnt-1, PlasmaDagIn);
+        for (int m = k+1; m < A.mt; m++)
+            plasma_dag_access(dag, m, k, PlasmaDagInout);
+    }
+
+    plasma_psgetrf_dryrun_args_t args =
+        { A, plasma->lookahead, plasma->max_panel_threads };
+    return plasma_dag_dryrun(dag, "sgetrf", A.m, A.n, A.nb, plasma->ib,
+                             plasma_psgetrf_describe, &args);
+}
@@ -0,0 +1,487 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzpotrf.c, normal z -> s, Sat Oct 17 13:39:23 2026
+ *
+ **/
+
+#include "flops.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_dag.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include <plasma_core_blas.h>
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+
+/******************************************************************************/
+// Kernels of the recorded task graph.
+enum {
+    PlasmaPotrfPotrf,   // factors tile (k, k)
+    PlasmaPotrfTrsm,    // solves tile (m, k), or (k, m) if upper
+    PlasmaPotrfUpdate,  // updates diagonal tile (m, m)
+    PlasmaPotrfGemm     // updates tile (m, n), or (n, m) if upper
+};
+
+// Arguments of the replayed kernels.
+typedef struct {
+    plasma_enum_t uplo;
+    plasma_desc_t A;
+    plasma_sequence_t *sequence;
+    plasma_request_t *request;
+} plasma_pspotrf_args_t;
+
+/******************************************************************************/
+// Records the tasks of plasma_pspotrf(), with the same dependences
+// as its OpenMP tasks.
+static void plasma_pspotrf_tasks(plasma_dag_t *dag, plasma_enum_t uplo,
+                                 int mt, int nt)
+{
+    int lower = uplo == PlasmaLower;
+    int kt = lower ? mt : nt;
+    for (int k = 0; k < kt; k++) {
+        plasma_dag_task(dag, PlasmaPotrfPotrf, k, k, k);
+        plasma_dag_access(dag, k, k, PlasmaDagInout);
+
+        for (int m = k+1; m < kt; m++) {
+            plasma_dag_task(dag, PlasmaPotrfTrsm, k, m, k);
+            plasma_dag_access(dag, k, k, PlasmaDagIn);
+            if (lower)
+                plasma_dag_access(dag, m, k, PlasmaDagInout);
+            else
+                plasma_dag_access(dag, k, m, PlasmaDagInout);
+        }
+        for (int m = k+1; m < kt; m++) {
+            plasma_dag_task(dag, PlasmaPotrfUpdate, k, m, m);
+            if (lower)
+                plasma_dag_access(dag, m, k, PlasmaDagIn);
+            else
+                plasma_dag_access(dag, k, m, PlasmaDagIn);
+            plasma_dag_access(dag, m, m, PlasmaDagInout);
+
+            for (int n = k+1; n < m; n++) {
+                plasma_dag_task(dag, PlasmaPotrfGemm, k, m, n);
+                if (lower) {
+                    plasma_dag_access(dag, m, k, PlasmaDagIn);
+                    plasma_dag_access(dag, n, k, PlasmaDagIn);
+                    plasma_dag_access(dag, m, n, PlasmaDagInout);
+                }
+                else {
+                    plasma_dag_access(dag, k, n, PlasmaDagIn);
+                    plasma_dag_access(dag, k, m, PlasmaDagIn);
+                    plasma_dag_access(dag, n, m, PlasmaDagInout);
+                }
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Records the task graph of plasma_pspotrf(). Returns NULL on failure.
+static plasma_dag_t *plasma_pspotrf_record(plasma_enum_t uplo, int mt, int nt)
+{
+    plasma_dag_t *dag = plasma_dag_create(PlasmaDagPotrf, uplo, mt, nt);
+    if (dag == NULL)
+        return NULL;
+
+    plasma_pspotrf_tasks(dag, uplo, mt, nt);
+    if (plasma_dag_finish(dag) != PlasmaSuccess) {
+        plasma_dag_destroy(dag);
+        return NULL;
+    }
+    return dag;
+}
+
+/******************************************************************************/
+// Runs one task of the recorded graph, as its OpenMP task would.
+static void plasma_pspotrf_run(const plasma_dag_task_t *task, void *arg)
+{
+    plasma_pspotrf_args_t *args = (plasma_pspotrf_args_t*)arg;
+    plasma_desc_t A = args->A;
+    if (args->sequence->status != PlasmaSuccess)
+        return;
+
+    int k = task->k;
+    int m = task->m;
+    int n = task->n;
+    int ldak = plasma_tile_mmain(A, k);
+    int ldam = plasma_tile_mmain(A, m);
+    int ldan = plasma_tile_mmain(A, n);
+    if (args->uplo == PlasmaLower) {
+        int mvak = plasma_tile_mview(A, k);
+        int mvam = plasma_tile_mview(A, m);
+        switch (task->kernel) {
+        case PlasmaPotrfPotrf: {
+            int info = plasma_core_spotrf(PlasmaLower, mvak, A(k, k), ldak);
+            if (info != 0)
+                plasma_request_fail(args->sequence, args->request,
+                                    A.nb*k+info);
+            break;
+        }
+        case PlasmaPotrfTrsm:
+            plasma_core_strsm(
+                PlasmaRight, PlasmaLower,
+                PlasmaConjTrans, PlasmaNonUnit,
+                mvam, A.mb,
+                1.0, A(k, k), ldak,
+                     A(m, k), ldam);
+            break;
+        case PlasmaPotrfUpdate:
+            plasma_core_ssyrk(
+                PlasmaLower, PlasmaNoTrans,
+                mvam, A.mb,
+                -1.0, A(m, k), ldam,
+                 1.0, A(m, m), ldam);
+            break;
+        case PlasmaPotrfGemm:
+            plasma_core_sgemm(
+                PlasmaNoTrans, PlasmaConjTrans,
+                mvam, A.mb, A.mb,
+                -1.0, A(m, k), ldam,
+                      A(n, k), ldan,
+                 1.0, A(m, n), ldam);
+            break;
+        }
+    }
+    else {
+        int nvak = plasma_tile_nview(A, k);
+        int nvam = plasma_tile_nview(A, m);
+        switch (task->kernel) {
+        case PlasmaPotrfPotrf: {
+            int info = plasma_core_spotrf(PlasmaUpper, nvak, A(k, k), ldak);
+            if (info != 0)
+                plasma_request_fail(args->sequence, args->request,
+                                    A.nb*k+info);
+            break;
+        }
+        case PlasmaPotrfTrsm:
+            plasma_core_strsm(
+                PlasmaLeft, PlasmaUpper,
+                PlasmaConjTrans, PlasmaNonUnit,
+                A.nb, nvam,
+                1.0, A(k, k), ldak,
+                     A(k, m), ldak);
+            break;
+        case PlasmaPotrfUpdate:
+            plasma_core_ssyrk(
+                PlasmaUpper, PlasmaConjTrans,
+                nvam, A.mb,
+                -1.0, A(k, m), ldak,
+                 1.0, A(m, m), ldam);
+            break;
+        case PlasmaPotrfGemm:
+            plasma_core_sgemm(
+                PlasmaConjTrans, PlasmaNoTrans,
+                A.mb, nvam, A.mb,
+                -1.0, A(k, n), ldak,
+                      A(k, m), ldak,
+                 1.0, A(n, m), ldan);
+            break;
+        }
+    }
+}
+
+/******************************************************************************/
+// Creates the task factoring diagonal tile (k, k).
+static void plasma_pspotrf_potrf(plasma_enum_t uplo, plasma_desc_t A,
+                                 int k, int priority,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int nvak = uplo == PlasmaLower ? plasma_tile_mview(A, k)
+                                   : plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    float *akk = A(k, k);
+
+    #pragma omp task depend(inout:akk[0:ldak*nvak]) \
+                     priority(priority)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            uint64_t start = plasma_trace_start();
+            int info = plasma_core_spotrf(uplo, nvak, akk, ldak);
+            plasma_trace_stop("spotrf", akk, nvak, nvak, start);
+            if (info != 0)
+                plasma_request_fail(sequence, request, A.nb*k+info);
+        }
+    }
+}
+
+/******************************************************************************/
+// Creates the task solving tile (m, k) of panel k, or (k, m) if upper.
+static void plasma_pspotrf_trsm(plasma_enum_t uplo, plasma_desc_t A,
+                                int k, int m, int priority,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    int ldak = plasma_tile_mmain(A, k);
+    float *akk = A(k, k);
+
+    if (uplo == PlasmaLower) {
+        int mvam = plasma_tile_mview(A, m);
+        int ldam = plasma_tile_mmain(A, m);
+        float *amk = A(m, k);
+
+        #pragma omp task depend(in:akk[0:ldak*A.mb]) \
+                         depend(inout:amk[0:ldam*A.mb]) \
+                         priority(priority)
+        {
+            if (sequence->status == PlasmaSuccess) {
+                uint64_t start = plasma_trace_start();
+                plasma_core_strsm(
+                    PlasmaRight, PlasmaLower,
+                    PlasmaConjTrans, PlasmaNonUnit,
+                    mvam, A.mb,
+                    1.0, akk, ldak,
+                         amk, ldam);
+                plasma_trace_stop("strsm", amk, mvam, A.mb, start);
+            }
+        }
+    }
+    else {
+        int nvam = plasma_tile_nview(A, m);
+        float *akm = A(k, m);
+
+        #pragma omp task depend(in:akk[0:ldak*A.nb]) \
+                         depend(inout:akm[0:ldak*nvam]) \
+                         priority(priority)
+        {
+            if (sequence->status == PlasmaSuccess) {
+                uint64_t start = plasma_trace_start();
+                plasma_core_strsm(
+                    PlasmaLeft, PlasmaUpper,
+                    PlasmaConjTrans, PlasmaNonUnit,
+                    A.nb, nvam,
+                    1.0, akk, ldak,
+                         akm, ldak);
+                plasma_trace_stop("strsm", akm, A.nb, nvam, start);
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Creates the task applying panel k to tile (m, n), m >= n,
+// or (n, m) if upper.
+static void plasma_pspotrf_update(plasma_enum_t uplo, plasma_desc_t A,
+                                  int k, int m, int n, int priority,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    int ldak = plasma_tile_mmain(A, k);
+    int ldam = plasma_tile_mmain(A, m);
+    int ldan = plasma_tile_mmain(A, n);
+
+    if (uplo == PlasmaLower) {
+        int mvam = plasma_tile_mview(A, m);
+        float *amk = A(m, k);
+        float *ank = A(n, k);
+        float *amn = A(m, n);
+
+        if (m == n) {
+            #pragma omp task depend(in:amk[0:ldam*A.mb]) \
+                             depend(inout:amn[0:ldam*mvam]) \
+                             priority(priority)
+            {
+                if (sequence->status == PlasmaSuccess) {
+                    uint64_t start = plasma_trace_start();
+                    plasma_core_ssyrk(
+                        PlasmaLower, PlasmaNoTrans,
+                        mvam, A.mb,
+                        -1.0, amk, ldam,
+                         1.0, amn, ldam);
+                    plasma_trace_stop("ssyrk", amn, mvam, mvam, start);
+                }
+            }
+        }
+        else {
+            #pragma omp task depend(in:amk[0:ldam*A.mb]) \
+                             depend(in:ank[0:ldan*A.mb]) \
+                             depend(inout:amn[0:ldam*A.mb]) \
+                             priority(priority)
+            {
+                if (sequence->status == PlasmaSuccess) {
+                    uint64_t start = plasma_trace_start();
+                    plasma_core_sgemm(
+                        PlasmaNoTrans, PlasmaConjTrans,
+                        mvam, A.mb, A.mb,
+                        -1.0, amk, ldam,
+                              ank, ldan,
+                         1.0, amn, ldam);
+                    plasma_trace_stop("sgemm", amn, mvam, A.mb, start);
+                }
+            }
+        }
+    }
+    else {
+        int nvam = plasma_tile_nview(A, m);
+        float *akm = A(k, m);
+        float *akn = A(k, n);
+        float *anm = A(n, m);
+
+        if (m == n) {
+            #pragma omp task depend(in:akm[0:ldak*nvam]) \
+                             depend(inout:anm[0:ldam*nvam]) \
+                             priority(priority)
+            {
+                if (sequence->status == PlasmaSuccess) {
+                    uint64_t start = plasma_trace_start();
+                    plasma_core_ssyrk(
+                        PlasmaUpper, PlasmaConjTrans,
+                        nvam, A.mb,
+                        -1.0, akm, ldak,
+                         1.0, anm, ldam);
+                    plasma_trace_stop("ssyrk", anm, nvam, nvam, start);
+                }
+            }
+        }
+        else {
+            #pragma omp task depend(in:akn[0:ldak*A.mb]) \
+                             depend(in:akm[0:ldak*nvam]) \
+                             depend(inout:anm[0:ldan*nvam]) \
+                             priority(priority)
+            {
+                if (sequence->status == PlasmaSuccess) {
+                    uint64_t start = plasma_trace_start();
+                    plasma_core_sgemm(
+                        PlasmaConjTrans, PlasmaNoTrans,
+                        A.mb, nvam, A.mb,
+                        -1.0, akn, ldak,
+                              akm, ldak,
+                         1.0, anm, ldan);
+                    plasma_trace_stop("sgemm", anm, A.mb, nvam, start);
+                }
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile Cholesky factorization.
+ *  The tasks of the next PlasmaLookahead panels are prioritized.
+ * @see plasma_omp_spotrf
+ ******************************************************************************/
+void plasma_pspotrf(plasma_enum_t uplo, plasma_desc_t A,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // With PlasmaTaskReplay, run the task graph recorded for this shape
+    // instead of creating the OpenMP tasks.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma != NULL && plasma->task_replay == PlasmaEnabled) {
+        plasma_dag_t *dag =
+            plasma_dag_find(PlasmaDagPotrf, uplo, A.mt, A.nt);
+        if (dag == NULL)
+            dag = plasma_pspotrf_record(uplo, A.mt, A.nt);
+        if (dag != NULL) {
+            plasma_pspotrf_args_t args = { uplo, A, sequence, request };
+            plasma_dag_replay(dag, plasma_pspotrf_run, &args);
+            return;
+        }
+    }
+
+    // Create the tasks of the next panels first, column by column,
+    // then the trailing updates behind them.
+    int la = plasma->lookahead;
+    int kt = uplo == PlasmaLower ? A.mt : A.nt;
+    for (int k = 0; k < kt; k++) {
+        plasma_pspotrf_potrf(uplo, A, k, la+1, sequence, request);
+        for (int m = k+1; m < kt; m++)
+            plasma_pspotrf_trsm(uplo, A, k, m, la+1, sequence, request);
+
+        int kla = imin(k+la, kt-1);
+        for (int n = k+1; n <= kla; n++) {
+            int priority = plasma_lookahead_priority(la, k, n);
+            for (int m = n; m < kt; m++)
+                plasma_pspotrf_update(uplo, A, k, m, n, priority,
+                                      sequence, request);
+        }
+        for (int m = kla+1; m < kt; m++) {
+            for (int n = kla+1; n <= m; n++)
+                plasma_pspotrf_update(uplo, A, k, m, n, 0,
+                                      sequence, request);
+        }
+    }
+}
+
+/******************************************************************************/
+// Arguments of the described kernels of a dry run.
+typedef struct {
+    plasma_enum_t uplo;
+    plasma_desc_t A;
+    int lookahead;
+} plasma_pspotrf_dryrun_args_t;
+
+/******************************************************************************/
+// Describes one task of a dry run, as plasma_pspotrf() would create it.
+static void plasma_pspotrf_describe(const plasma_dag_task_t *task, void *arg,
+                                    plasma_dag_info_t *info)
+{
+    plasma_pspotrf_dryrun_args_t *args = (plasma_pspotrf_dryrun_args_t*)arg;
+    plasma_desc_t A = args->A;
+    int la = args->lookahead;
+    int lower = args->uplo == PlasmaLower;
+
+    // Tile sizes along the factored dimension.
+    int vk = lower ? plasma_tile_mview(A, task->k)
+                   : plasma_tile_nview(A, task->k);
+    int vm = lower ? plasma_tile_mview(A, task->m)
+                   : plasma_tile_nview(A, task->m);
+    int vn = lower ? plasma_tile_mview(A, task->n)
+                   : plasma_tile_nview(A, task->n);
+
+    info->threads = 1;
+    switch (task->kernel) {
+    case PlasmaPotrfPotrf:
+        info->name = "spotrf";
+        info->flops = flops_spotrf(vk);
+        info->priority = la+1;
+        break;
+    case PlasmaPotrfTrsm:
+        info->name = "strsm";
+        info->flops = flops_strsm(PlasmaRight, vm, vk);
+        info->priority = la+1;
+        break;
+    case PlasmaPotrfUpdate:
+        info->name = "ssyrk";
+        info->flops = flops_ssyrk(vm, vk);
+        info->priority = plasma_lookahead_priority(la, task->k, task->n);
+        break;
+    case PlasmaPotrfGemm:
+        info->name = "sgemm";
+        info->flops = flops_sgemm(vm, vn, vk);
+        info->priority = plasma_lookahead_priority(la, task->k, task->n);
+        break;
+    }
+}
+
+/***************************************************************************//**
+ *  Records the task graph of plasma_pspotrf() for plasma_dag_write(),
+ *  without running it. A needs no memory.
+ * @see plasma_omp_spotrf
+ ******************************************************************************/
+int plasma_pspotrf_dryrun(plasma_enum_t uplo, plasma_desc_t A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL)
+        return PlasmaErrorNotInitialized;
+
+    plasma_dag_t *dag = plasma_dag_create(PlasmaDagPotrf, uplo, A.mt, A.nt);
+    if (dag == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    plasma_pspotrf_tasks(dag, uplo, A.mt, A.nt);
+    plasma_pspotrf_dryrun_args_t args = { uplo, A, plasma->lookahead };
+    return plasma_dag_dryrun(dag, "spotrf", A.m, A.n, A.nb, 0,
+                             plasma_pspotrf_describe, &args);
+}
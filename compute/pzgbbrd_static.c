@@ -14,12 +14,12 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_static.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include "bulge.h"
 #include "plasma_core_blas.h"
 #include <omp.h>
-#include <sched.h>
 #include <string.h>
 
 #undef REAL
@@ -27,17 +27,8 @@
 
 #define shift 3
 
-#define ss_cond_set(m, n, val)                  \
-    {                                                   \
-        plasma->ss_progress[(m)+plasma->ss_ld*(n)] = (val); \
-    }
-
-
-#define ss_cond_wait(m, n, val) \
-    {                                                           \
-        while (plasma->ss_progress[(m)+plasma->ss_ld*(n)] != (val)) \
-            sched_yield();                                          \
-    }
+#define ss_cond_set(m, n, val)  plasma_static_set(plasma, m, n, val)
+#define ss_cond_wait(m, n, val) plasma_static_wait(plasma, m, n, val)
 
 
 #define AL(m_, n_) (A + nb + lda * (n_) + ((m_)-(n_)))
@@ -86,9 +77,10 @@ void plasma_pzgbbrd_static (plasma_enum_t uplo, int minmn, int nb, int Vblksiz,
         cores_num  = omp_get_num_threads();
     }
     int size = 2*nbtiles+shift+cores_num+10;
-    plasma->ss_progress = (volatile int *)malloc(size*sizeof(int));
-    for(int index = 0; index < size; index++) plasma->ss_progress[index] = 0;
-    plasma->ss_ld = (size);
+    if (plasma_static_init(plasma, size, 1) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
     
     // main bulge chasing code
     int allcoresnb = cores_num;
@@ -174,7 +166,7 @@ void plasma_pzgbbrd_static (plasma_enum_t uplo, int minmn, int nb, int Vblksiz,
         } // for thgrid=1:thgrnb
     }
 
-    free((void*)plasma->ss_progress);
+    plasma_static_finalize(plasma);
 
     //===========================================================
     //  store resulting diag and lower diag D and E
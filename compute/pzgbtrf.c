@@ -70,7 +70,7 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
             volatile int info = 0;
 
             plasma_barrier_t barrier;
-            plasma_barrier_init(&barrier);
+            plasma_barrier_init(&barrier, plasma->barrier_mode);
 
             if (sequence->status == PlasmaSuccess) {
                 for (int rank = 0; rank < num_panel_threads; rank++) {
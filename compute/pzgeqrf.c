@@ -10,19 +10,188 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
+#include "plasma_dag.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tree.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
 
+#include <omp.h>
+
 #define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
 #define T(m, n) (plasma_complex64_t*)plasma_tile_addr(T, m, n)
 
+/******************************************************************************/
+// Creates the task factoring tile (k, k).
+static void plasma_pzgeqrf_geqrt(plasma_desc_t A, plasma_desc_t T, int k,
+                                 plasma_workspace_t work, int priority,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int ib = T.mb;
+    int mvak = plasma_tile_mview(A, k);
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    plasma_complex64_t *akk = A(k, k);
+    plasma_complex64_t *tkk = T(k, k);
+
+    #pragma omp task depend(inout:akk[0:ldak*nvak]) \
+                     depend(out:tkk[0:ib*nvak]) \
+                     priority(priority)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int tid = omp_get_thread_num();
+            plasma_complex64_t *tau = (plasma_complex64_t*)work.spaces[tid];
+            uint64_t start = plasma_trace_start();
+            int info = plasma_core_zgeqrt(mvak, nvak, ib,
+                                          akk, ldak,
+                                          tkk, T.mb,
+                                          tau, tau+nvak);
+            plasma_trace_stop("zgeqrt", akk, mvak, nvak, start);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_zgeqrt() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Creates the task applying the reflectors of tile (k, k) to tile (k, n).
+static void plasma_pzgeqrf_unmqr(plasma_desc_t A, plasma_desc_t T,
+                                 int k, int n,
+                                 plasma_workspace_t work, int priority,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int ib = T.mb;
+    int mvak = plasma_tile_mview(A, k);
+    int nvak = plasma_tile_nview(A, k);
+    int nvan = plasma_tile_nview(A, n);
+    int ldak = plasma_tile_mmain(A, k);
+    int kk = imin(mvak, nvak);
+    plasma_complex64_t *akk = A(k, k);
+    plasma_complex64_t *tkk = T(k, k);
+    plasma_complex64_t *akn = A(k, n);
+
+    #pragma omp task depend(in:akk[0:ldak*kk]) \
+                     depend(in:tkk[0:ib*kk]) \
+                     depend(inout:akn[0:ldak*nvan]) \
+                     priority(priority)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int tid = omp_get_thread_num();
+            plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
+            uint64_t start = plasma_trace_start();
+            int info = plasma_core_zunmqr(PlasmaLeft, Plasma_ConjTrans,
+                                          mvak, nvan, kk, ib,
+                                          akk, ldak,
+                                          tkk, T.mb,
+                                          akn, ldak,
+                                          W, nvan);
+            plasma_trace_stop("zunmqr", akn, mvak, nvan, start);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_zunmqr() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Creates the task annihilating tile (m, k) against tile (k, k).
+static void plasma_pzgeqrf_tsqrt(plasma_desc_t A, plasma_desc_t T,
+                                 int k, int m,
+                                 plasma_workspace_t work, int priority,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int ib = T.mb;
+    int mvam = plasma_tile_mview(A, m);
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    int ldam = plasma_tile_mmain(A, m);
+    plasma_complex64_t *akk = A(k, k);
+    plasma_complex64_t *amk = A(m, k);
+    plasma_complex64_t *tmk = T(m, k);
+
+    #pragma omp task depend(inout:akk[0:ldak*nvak]) \
+                     depend(inout:amk[0:ldam*nvak]) \
+                     depend(out:tmk[0:ib*nvak]) \
+                     priority(priority)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int tid = omp_get_thread_num();
+            plasma_complex64_t *tau = (plasma_complex64_t*)work.spaces[tid];
+            uint64_t start = plasma_trace_start();
+            int info = plasma_core_ztsqrt(mvam, nvak, ib,
+                                          akk, ldak,
+                                          amk, ldam,
+                                          tmk, T.mb,
+                                          tau, tau+nvak);
+            plasma_trace_stop("ztsqrt", amk, mvam, nvak, start);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_ztsqrt() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Creates the task applying the reflectors of tile (m, k)
+// to tiles (k, n) and (m, n).
+static void plasma_pzgeqrf_tsmqr(plasma_desc_t A, plasma_desc_t T,
+                                 int k, int m, int n,
+                                 plasma_workspace_t work, int priority,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int ib = T.mb;
+    int mvam = plasma_tile_mview(A, m);
+    int nvak = plasma_tile_nview(A, k);
+    int nvan = plasma_tile_nview(A, n);
+    int ldak = plasma_tile_mmain(A, k);
+    int ldam = plasma_tile_mmain(A, m);
+    plasma_complex64_t *akn = A(k, n);
+    plasma_complex64_t *amn = A(m, n);
+    plasma_complex64_t *amk = A(m, k);
+    plasma_complex64_t *tmk = T(m, k);
+
+    #pragma omp task depend(inout:akn[0:ldak*nvan]) \
+                     depend(inout:amn[0:ldam*nvan]) \
+                     depend(in:amk[0:ldam*nvak]) \
+                     depend(in:tmk[0:ib*nvak]) \
+                     priority(priority)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int tid = omp_get_thread_num();
+            plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
+            uint64_t start = plasma_trace_start();
+            int info = plasma_core_ztsmqr(PlasmaLeft, Plasma_ConjTrans,
+                                          A.mb, nvan, mvam, nvan, nvak, ib,
+                                          akn, ldak,
+                                          amn, ldam,
+                                          amk, ldam,
+                                          tmk, T.mb,
+                                          W, ib);
+            plasma_trace_stop("ztsmqr", amn, mvam, nvan, start);
+            if (info != PlasmaSuccess) {
+                plasma_error("core_ztsmqr() failed");
+                plasma_request_fail(sequence, request, PlasmaErrorInternal);
+            }
+        }
+    }
+}
+
 /***************************************************************************//**
  *  Parallel tile QR factorization - dynamic scheduling
+ *  The tasks of the next PlasmaLookahead panels are prioritized.
  * @see plasma_omp_zgeqrf
  **/
 void plasma_pzgeqrf(plasma_desc_t A, plasma_desc_t T,
@@ -33,54 +202,207 @@ void plasma_pzgeqrf(plasma_desc_t A, plasma_desc_t T,
     if (sequence->status != PlasmaSuccess)
         return;
 
-    // Set inner blocking from the T tile row-dimension.
-    int ib = T.mb;
+    // Panels come first, then the updates of the next la panels.
+    plasma_context_t *plasma = plasma_context_self();
+    int la = plasma->lookahead;
 
     for (int k = 0; k < imin(A.mt, A.nt); k++) {
-        int mvak = plasma_tile_mview(A, k);
-        int nvak = plasma_tile_nview(A, k);
-        int ldak = plasma_tile_mmain(A, k);
-        plasma_core_omp_zgeqrt(
-            mvak, nvak, ib,
-            A(k, k), ldak,
-            T(k, k), T.mb,
-            work,
-            sequence, request);
+        plasma_pzgeqrf_geqrt(A, T, k, work, la+1, sequence, request);
 
         for (int n = k+1; n < A.nt; n++) {
-            int nvan = plasma_tile_nview(A, n);
-            plasma_core_omp_zunmqr(
-                PlasmaLeft, Plasma_ConjTrans,
-                mvak, nvan, imin(mvak, nvak), ib,
-                A(k, k), ldak,
-                T(k, k), T.mb,
-                A(k, n), ldak,
-                work,
-                sequence, request);
+            plasma_pzgeqrf_unmqr(A, T, k, n, work,
+                                 plasma_lookahead_priority(la, k, n),
+                                 sequence, request);
         }
         for (int m = k+1; m < A.mt; m++) {
-            int mvam = plasma_tile_mview(A, m);
-            int ldam = plasma_tile_mmain(A, m);
-            plasma_core_omp_ztsqrt(
-                mvam, nvak, ib,
-                A(k, k), ldak,
-                A(m, k), ldam,
-                T(m, k), T.mb,
-                work,
-                sequence, request);
+            plasma_pzgeqrf_tsqrt(A, T, k, m, work, la+1, sequence, request);
 
             for (int n = k+1; n < A.nt; n++) {
-                int nvan = plasma_tile_nview(A, n);
-                plasma_core_omp_ztsmqr(
-                    PlasmaLeft, Plasma_ConjTrans,
-                    A.mb, nvan, mvam, nvan, nvak, ib,
-                    A(k, n), ldak,
-                    A(m, n), ldam,
-                    A(m, k), ldam,
-                    T(m, k), T.mb,
-                    work,
-                    sequence, request);
+                plasma_pzgeqrf_tsmqr(A, T, k, m, n, work,
+                                     plasma_lookahead_priority(la, k, n),
+                                     sequence, request);
             }
         }
     }
 }
+
+/******************************************************************************/
+// Kernels of the task graph of a dry run. Tasks eliminate column k
+// in tile row m, and update tile (m, n).
+enum {
+    PlasmaGeqrfGeqrt,  // factors tile (m, k)
+    PlasmaGeqrfUnmqr,  // applies the reflectors of tile (m, k) to (m, n)
+    PlasmaGeqrfTsqrt,  // eliminates tile (m, k) with a triangle above it
+    PlasmaGeqrfTsmqr,  // applies the reflectors of the tsqrt to (m, n)
+    PlasmaGeqrfTtqrt,  // eliminates triangle (m, k) with a triangle above it
+    PlasmaGeqrfTtmqr   // applies the reflectors of the ttqrt to (m, n)
+};
+
+// Arguments of the described kernels of a dry run.
+typedef struct {
+    plasma_desc_t A;
+    int lookahead;
+    int tree;
+} plasma_pzgeqrf_dryrun_args_t;
+
+/******************************************************************************/
+// Describes one task of a dry run, as plasma_pzgeqrf() or
+// plasma_pzgeqrf_tree() would create it. The triangle-on-square kernels
+// are costed as the QR of the stacked tiles without the triangle, and the
+// triangle-on-triangle ones as a third of the factorization and half of
+// the update.
+static void plasma_pzgeqrf_describe(const plasma_dag_task_t *task, void *arg,
+                                    plasma_dag_info_t *info)
+{
+    plasma_pzgeqrf_dryrun_args_t *args = (plasma_pzgeqrf_dryrun_args_t*)arg;
+    plasma_desc_t A = args->A;
+    int la = args->lookahead;
+    int nvak = plasma_tile_nview(A, task->k);
+    int mvam = plasma_tile_mview(A, task->m);
+    int nvan = plasma_tile_nview(A, task->n);
+
+    double tsqrt = flops_zgeqrf(nvak+mvam, nvak)-flops_zgeqrf(nvak, nvak);
+    double tsmqr = flops_zunmqr(PlasmaLeft, nvak+mvam, nvan, nvak)-
+                   flops_zunmqr(PlasmaLeft, nvak, nvan, nvak);
+    int panel = args->tree ? 0 : la+1;
+    int update = args->tree ? 0 :
+                 plasma_lookahead_priority(la, task->k, task->n);
+
+    info->threads = 1;
+    switch (task->kernel) {
+    case PlasmaGeqrfGeqrt:
+        info->name = "zgeqrt";
+        info->flops = flops_zgeqrf(mvam, nvak);
+        info->priority = panel;
+        break;
+    case PlasmaGeqrfUnmqr:
+        info->name = "zunmqr";
+        info->flops = flops_zunmqr(PlasmaLeft, mvam, nvan, imin(mvam, nvak));
+        info->priority = update;
+        break;
+    case PlasmaGeqrfTsqrt:
+        info->name = "ztsqrt";
+        info->flops = tsqrt;
+        info->priority = panel;
+        break;
+    case PlasmaGeqrfTsmqr:
+        info->name = "ztsmqr";
+        info->flops = tsmqr;
+        info->priority = update;
+        break;
+    case PlasmaGeqrfTtqrt:
+        info->name = "zttqrt";
+        info->flops = tsqrt/3.0;
+        info->priority = panel;
+        break;
+    case PlasmaGeqrfTtmqr:
+        info->name = "zttmqr";
+        info->flops = tsmqr/2.0;
+        info->priority = update;
+        break;
+    }
+}
+
+/******************************************************************************/
+// Records the tasks of plasma_pzgeqrf_tree(). Returns the error of
+// plasma_tree_operations().
+static int plasma_pzgeqrf_tree_tasks(plasma_dag_t *dag, plasma_desc_t A)
+{
+    plasma_sequence_t sequence;
+    plasma_request_t request;
+    plasma_sequence_init(&sequence);
+    plasma_request_init(&request);
+
+    int *operations = NULL;
+    int num_operations;
+    plasma_tree_operations(A.mt, A.nt, &operations, &num_operations,
+                           &sequence, &request);
+    if (sequence.status != PlasmaSuccess)
+        return sequence.status;
+
+    for (int iop = 0; iop < num_operations; iop++) {
+        int j, k, kpiv;
+        plasma_enum_t kernel;
+        plasma_tree_get_operation(operations, iop, &kernel, &j, &k, &kpiv);
+
+        if (kernel == PlasmaGeKernel) {
+            plasma_dag_task(dag, PlasmaGeqrfGeqrt, j, k, j);
+            plasma_dag_access(dag, k, j, PlasmaDagInout);
+            for (int jj = j+1; jj < A.nt; jj++) {
+                plasma_dag_task(dag, PlasmaGeqrfUnmqr, j, k, jj);
+                plasma_dag_access(dag, k, j, PlasmaDagIn);
+                plasma_dag_access(dag, k, jj, PlasmaDagInout);
+            }
+        }
+        else {
+            int tt = kernel == PlasmaTtKernel;
+            plasma_dag_task(dag, tt ? PlasmaGeqrfTtqrt : PlasmaGeqrfTsqrt,
+                            j, k, j);
+            plasma_dag_access(dag, kpiv, j, PlasmaDagInout);
+            plasma_dag_access(dag, k, j, PlasmaDagInout);
+            for (int jj = j+1; jj < A.nt; jj++) {
+                plasma_dag_task(dag, tt ? PlasmaGeqrfTtmqr : PlasmaGeqrfTsmqr,
+                                j, k, jj);
+                plasma_dag_access(dag, kpiv, jj, PlasmaDagInout);
+                plasma_dag_access(dag, k, jj, PlasmaDagInout);
+                plasma_dag_access(dag, k, j, PlasmaDagIn);
+            }
+        }
+    }
+    free(operations);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *  Records the task graph of plasma_pzgeqrf(), or of plasma_pzgeqrf_tree()
+ *  with PlasmaTreeHouseholder, for plasma_dag_write(), without running it.
+ *  A needs no memory.
+ * @see plasma_omp_zgeqrf
+ ******************************************************************************/
+int plasma_pzgeqrf_dryrun(plasma_desc_t A, int ib)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL)
+        return PlasmaErrorNotInitialized;
+
+    int tree = plasma->householder_mode == PlasmaTreeHouseholder;
+    plasma_dag_t *dag = plasma_dag_create(PlasmaDagGeqrf,
+                                          plasma->householder_mode,
+                                          A.mt, A.nt);
+    if (dag == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    if (tree) {
+        int retval = plasma_pzgeqrf_tree_tasks(dag, A);
+        if (retval != PlasmaSuccess) {
+            plasma_dag_destroy(dag);
+            return retval;
+        }
+    }
+    else {
+        for (int k = 0; k < imin(A.mt, A.nt); k++) {
+            plasma_dag_task(dag, PlasmaGeqrfGeqrt, k, k, k);
+            plasma_dag_access(dag, k, k, PlasmaDagInout);
+            for (int n = k+1; n < A.nt; n++) {
+                plasma_dag_task(dag, PlasmaGeqrfUnmqr, k, k, n);
+                plasma_dag_access(dag, k, k, PlasmaDagIn);
+                plasma_dag_access(dag, k, n, PlasmaDagInout);
+            }
+            for (int m = k+1; m < A.mt; m++) {
+                plasma_dag_task(dag, PlasmaGeqrfTsqrt, k, m, k);
+                plasma_dag_access(dag, k, k, PlasmaDagInout);
+                plasma_dag_access(dag, m, k, PlasmaDagInout);
+                for (int n = k+1; n < A.nt; n++) {
+                    plasma_dag_task(dag, PlasmaGeqrfTsmqr, k, m, n);
+                    plasma_dag_access(dag, k, n, PlasmaDagInout);
+                    plasma_dag_access(dag, m, n, PlasmaDagInout);
+                    plasma_dag_access(dag, m, k, PlasmaDagIn);
+                }
+            }
+        }
+    }
+
+    plasma_pzgeqrf_dryrun_args_t args = { A, plasma->lookahead, tree };
+    return plasma_dag_dryrun(dag, "zgeqrf", A.m, A.n, A.nb, ib,
+                             plasma_pzgeqrf_describe, &args);
+}
@@ -10,8 +10,10 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
+#include "plasma_dag.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_types.h"
@@ -34,6 +36,9 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
     // Set tiling parameters.
     int ib = plasma->ib;
 
+    // Panels come first, then the updates of the next la panels.
+    int la = plasma->lookahead;
+
     int minmtnt = imin(A.mt, A.nt);
 
     for (int k = 0; k < minmtnt; k++) {
@@ -48,7 +53,7 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
             plasma_complex64_t *amk = A(m, k);
             #pragma omp task depend (in:amk[0]) \
                              depend (inout:a00[0]) \
-                             priority(1)
+                             priority(la+1)
             {
                 // Do some funny work here. It appears so that the compiler
                 // might not insert the task if it is completely empty.
@@ -71,7 +76,7 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
         #pragma omp task depend(inout:a00[0:ma00k*na00k]) \
                          depend(inout:a20[0:lda20*nvak]) \
                          depend(out:ipiv[k*A.mb:mvak]) \
-                         priority(1)
+                         priority(la+1)
         {
             volatile int *max_idx = (int*)malloc(num_panel_threads*sizeof(int));
             if (max_idx == NULL)
@@ -86,7 +91,7 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
             volatile int info = 0;
 
             plasma_barrier_t barrier;
-            plasma_barrier_init(&barrier);
+            plasma_barrier_init(&barrier, plasma->barrier_mode);
 
             if (sequence->status == PlasmaSuccess) {
                 // If nesting would not be expensive on architectures such as
@@ -97,9 +102,10 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                 //                         num_threads(num_panel_threads)
                 #pragma omp taskloop untied shared(barrier) \
                                      num_tasks(num_panel_threads) \
-                                     priority(2)
+                                     priority(la+2)
                 for (int rank = 0; rank < num_panel_threads; rank++) {
                     {
+                        uint64_t start = plasma_trace_start();
                         plasma_desc_t view =
                             plasma_desc_view(A,
                                              k*A.mb, k*A.nb,
@@ -109,6 +115,8 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                                     rank, num_panel_threads,
                                     max_idx, max_val, &info,
                                     &barrier);
+                        plasma_trace_stop("zgetrf", a00, A.m-k*A.mb, nvak,
+                                          start);
 
                         if (info != 0)
                             plasma_request_fail(sequence, request, k*A.mb+info);
@@ -136,6 +144,23 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
             int lda21 = plasma_tile_mmain(A, A.mt-1);
 
             int nvan = plasma_tile_nview(A, n);
+            int priority = plasma_lookahead_priority(la, k, n);
+
+            // Create fake dependencies of the first update of the column
+            // on its individual tiles, as for the panel. The next updates
+            // of the column follow the first one.
+            if (k == 0) {
+                for (int m = k+2; m < A.mt-1; m++) {
+                    plasma_complex64_t *amn = A(m, n);
+                    #pragma omp task depend (in:amn[0]) \
+                                     depend (inout:a11[0]) \
+                                     priority(priority)
+                    {
+                        int l = 1;
+                        l++;
+                    }
+                }
+            }
 
             #pragma omp task depend(in:a00[0:ma00k*na00k]) \
                              depend(in:a20[0:lda20*nvak]) \
@@ -143,7 +168,7 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                              depend(inout:a01[0:ldak*nvan]) \
                              depend(inout:a11[0:ma11k*na11n]) \
                              depend(inout:a21[0:lda21*nvan]) \
-                             priority(n == k+1)
+                             priority(priority)
             {
                 if (sequence->status == PlasmaSuccess) {
                     // geswp
@@ -151,27 +176,34 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                     int k2 = imin(k*A.mb+A.mb, A.m);
                     plasma_desc_t view =
                         plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+                    uint64_t start = plasma_trace_start();
                     plasma_core_zgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+                    plasma_trace_stop("zgeswp", A(0, n), A.m, nvan, start);
 
                     // trsm
+                    start = plasma_trace_start();
                     plasma_core_ztrsm(PlasmaLeft, PlasmaLower,
                                PlasmaNoTrans, PlasmaUnit,
                                mvak, nvan,
                                1.0, A(k, k), ldak,
                                     A(k, n), ldak);
+                    plasma_trace_stop("ztrsm", A(k, n), mvak, nvan, start);
                     // gemm
                     for (int m = k+1; m < A.mt; m++) {
                         int mvam = plasma_tile_mview(A, m);
                         int ldam = plasma_tile_mmain(A, m);
 
-                        #pragma omp task priority(n == k+1)
+                        #pragma omp task priority(priority)
                         {
+                            uint64_t start = plasma_trace_start();
                             plasma_core_zgemm(
                                 PlasmaNoTrans, PlasmaNoTrans,
                                 mvam, nvan, A.nb,
                                 -1.0, A(m, k), ldam,
                                       A(k, n), ldak,
                                 1.0,  A(m, n), ldam);
+                            plasma_trace_stop("zgemm", A(m, n), mvam, nvan,
+                                              start);
                         }
                     }
                 }
@@ -231,3 +263,112 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
         }
     }
 }
+
+/******************************************************************************/
+// Kernels of the task graph of a dry run.
+enum {
+    PlasmaGetrfPanel,   // factors panel k
+    PlasmaGetrfUpdate,  // swaps rows of column n and solves tile (k, n)
+    PlasmaGetrfGemm,    // updates tile (m, n)
+    PlasmaGetrfSwap     // swaps rows of column k to the left
+};
+
+// Arguments of the described kernels of a dry run.
+typedef struct {
+    plasma_desc_t A;
+    int lookahead;
+    int max_panel_threads;
+} plasma_pzgetrf_dryrun_args_t;
+
+/******************************************************************************/
+// Describes one task of a dry run, as plasma_pzgetrf() would create it.
+static void plasma_pzgetrf_describe(const plasma_dag_task_t *task, void *arg,
+                                    plasma_dag_info_t *info)
+{
+    plasma_pzgetrf_dryrun_args_t *args = (plasma_pzgetrf_dryrun_args_t*)arg;
+    plasma_desc_t A = args->A;
+    int la = args->lookahead;
+    int k = task->k;
+    int mvak = plasma_tile_mview(A, k);
+    int nvak = plasma_tile_nview(A, k);
+    int mvam = plasma_tile_mview(A, task->m);
+    int nvan = plasma_tile_nview(A, task->n);
+
+    info->threads = 1;
+    switch (task->kernel) {
+    case PlasmaGetrfPanel:
+        info->name = "zgetrf";
+        info->flops = flops_zgetrf(A.m-k*A.mb, nvak);
+        info->priority = la+1;
+        info->threads = imin(args->max_panel_threads,
+                             imin(A.mt, A.nt)-k);
+        break;
+    case PlasmaGetrfUpdate:
+        info->name = "ztrsm";
+        info->flops = flops_ztrsm(PlasmaLeft, mvak, nvan);
+        info->priority = plasma_lookahead_priority(la, k, task->n);
+        break;
+    case PlasmaGetrfGemm:
+        info->name = "zgemm";
+        info->flops = flops_zgemm(mvam, nvan, A.nb);
+        info->priority = plasma_lookahead_priority(la, k, task->n);
+        break;
+    case PlasmaGetrfSwap:
+        info->name = "zgeswp";
+        info->flops = 0.0;
+        info->priority = 0;
+        break;
+    }
+}
+
+/***************************************************************************//**
+ *  Records the task graph of plasma_pzgetrf() for plasma_dag_write(),
+ *  without running it. A needs no memory. The gemm tasks, nested in the
+ *  update of their column, are recorded as tasks of their own, and the
+ *  tasks adding dependences on whole panels are left out.
+ * @see plasma_omp_zgetrf
+ ******************************************************************************/
+int plasma_pzgetrf_dryrun(plasma_desc_t A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL)
+        return PlasmaErrorNotInitialized;
+
+    plasma_dag_t *dag = plasma_dag_create(PlasmaDagGetrf, 0, A.mt, A.nt);
+    if (dag == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    int minmtnt = imin(A.mt, A.nt);
+    for (int k = 0; k < minmtnt; k++) {
+        plasma_dag_task(dag, PlasmaGetrfPanel, k, k, k);
+        for (int m = k; m < A.mt; m++)
+            plasma_dag_access(dag, m, k, PlasmaDagInout);
+
+        for (int n = k+1; n < A.nt; n++) {
+            plasma_dag_task(dag, PlasmaGetrfUpdate, k, k, n);
+            plasma_dag_access(dag, k, k, PlasmaDagIn);
+            for (int m = k; m < A.mt; m++)
+                plasma_dag_access(dag, m, n, PlasmaDagInout);
+
+            for (int m = k+1; m < A.mt; m++) {
+                plasma_dag_task(dag, PlasmaGetrfGemm, k, m, n);
+                plasma_dag_access(dag, m, k, PlasmaDagIn);
+                plasma_dag_access(dag, k, n, PlasmaDagIn);
+                plasma_dag_access(dag, m, n, PlasmaDagInout);
+            }
+        }
+    }
+    // The swaps to the left wait for the pivots of the last panel,
+    // which follows all the others.
+    for (int k = 0; k < minmtnt-1; k++) {
+        plasma_dag_task(dag, PlasmaGetrfSwap, k, k+1, k);
+        plasma_dag_access(dag, minmtnt-1, minmtnt-1, PlasmaDagIn);
+        for (int m = k+1; m < A.mt; m++)
+            plasma_dag_access(dag, m, k, PlasmaDagInout);
+    }
+
+    plasma_pzgetrf_dryrun_args_t args =
+        { A, plasma->lookahead, plasma->max_panel_threads };
+    return plasma_dag_dryrun(dag, "zgetrf", A.m, A.n, A.nb, plasma->ib,
+                             plasma_pzgetrf_describe, &args);
+}
@@ -449,7 +449,7 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                     volatile int info = 0;
 
                     plasma_barrier_t barrier;
-                    plasma_barrier_init(&barrier);
+                    plasma_barrier_init(&barrier, plasma->barrier_mode);
 
                     if (sequence->status == PlasmaSuccess) {
                         for (int rank = 0; rank < num_panel_threads; rank++) {
@@ -555,7 +555,7 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                                      depend(inout:a2[0:mnt2])
                     {
                         plasma_barrier_t barrier;
-                        plasma_barrier_init(&barrier);
+                        plasma_barrier_init(&barrier, plasma->barrier_mode);
                         for (int rank = 0; rank < num_swap_threads; rank++) {
                             #pragma omp task shared(barrier)
                             {
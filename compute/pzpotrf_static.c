@@ -0,0 +1,210 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_static.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+
+/******************************************************************************/
+typedef struct {
+    plasma_context_t *plasma;
+    plasma_enum_t uplo;
+    plasma_desc_t A;
+    plasma_sequence_t *sequence;
+    plasma_request_t *request;
+} plasma_pzpotrf_static_args_t;
+
+/******************************************************************************/
+// Factors the tiles owned by the thread, right-looking. The updates of a
+// tile are all applied by its owner, in order, so the progress table only
+// flags the tiles final: the diagonal tile after its factorization,
+// the tiles of the panel after their triangular solves.
+static void plasma_pzpotrf_static_worker(int rank, int size, void *arg)
+{
+    plasma_pzpotrf_static_args_t *args = (plasma_pzpotrf_static_args_t*)arg;
+    plasma_desc_t A = args->A;
+    plasma_context_t *plasma = args->plasma;
+    plasma_static_grid_t grid = plasma_static_grid_2d(size);
+
+    //==============
+    // PlasmaLower
+    //==============
+    if (args->uplo == PlasmaLower) {
+        for (int k = 0; k < A.mt; k++) {
+            int mvak = plasma_tile_mview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+            if (plasma_static_owner(grid, k, k) == rank) {
+                uint64_t start = plasma_trace_start();
+                int info = plasma_core_zpotrf(PlasmaLower, mvak,
+                                              A(k, k), ldak);
+                plasma_trace_stop("zpotrf", A(k, k), mvak, mvak, start);
+                if (info != 0) {
+                    plasma_request_fail(args->sequence, args->request,
+                                        A.nb*k+info);
+                    plasma_static_abort(plasma);
+                    return;
+                }
+                plasma_static_set(plasma, k, k, 1);
+            }
+            for (int m = k+1; m < A.mt; m++) {
+                if (plasma_static_owner(grid, m, k) == rank) {
+                    if (plasma_static_wait(plasma, k, k, 1))
+                        return;
+                    int mvam = plasma_tile_mview(A, m);
+                    int ldam = plasma_tile_mmain(A, m);
+                    uint64_t start = plasma_trace_start();
+                    plasma_core_ztrsm(
+                        PlasmaRight, PlasmaLower,
+                        PlasmaConjTrans, PlasmaNonUnit,
+                        mvam, A.mb,
+                        1.0, A(k, k), ldak,
+                             A(m, k), ldam);
+                    plasma_trace_stop("ztrsm", A(m, k), mvam, A.mb, start);
+                    plasma_static_set(plasma, m, k, 1);
+                }
+            }
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                if (plasma_static_owner(grid, m, m) == rank) {
+                    if (plasma_static_wait(plasma, m, k, 1))
+                        return;
+                    uint64_t start = plasma_trace_start();
+                    plasma_core_zherk(
+                        PlasmaLower, PlasmaNoTrans,
+                        mvam, A.mb,
+                        -1.0, A(m, k), ldam,
+                         1.0, A(m, m), ldam);
+                    plasma_trace_stop("zherk", A(m, m), mvam, mvam, start);
+                }
+                for (int n = k+1; n < m; n++) {
+                    if (plasma_static_owner(grid, m, n) == rank) {
+                        if (plasma_static_wait(plasma, m, k, 1) ||
+                            plasma_static_wait(plasma, n, k, 1))
+                            return;
+                        int ldan = plasma_tile_mmain(A, n);
+                        uint64_t start = plasma_trace_start();
+                        plasma_core_zgemm(
+                            PlasmaNoTrans, PlasmaConjTrans,
+                            mvam, A.mb, A.mb,
+                            -1.0, A(m, k), ldam,
+                                  A(n, k), ldan,
+                             1.0, A(m, n), ldam);
+                        plasma_trace_stop("zgemm", A(m, n), mvam, A.mb, start);
+                    }
+                }
+            }
+        }
+    }
+    //==============
+    // PlasmaUpper
+    //==============
+    else {
+        for (int k = 0; k < A.nt; k++) {
+            int nvak = plasma_tile_nview(A, k);
+            int ldak = plasma_tile_mmain(A, k);
+            if (plasma_static_owner(grid, k, k) == rank) {
+                uint64_t start = plasma_trace_start();
+                int info = plasma_core_zpotrf(PlasmaUpper, nvak,
+                                              A(k, k), ldak);
+                plasma_trace_stop("zpotrf", A(k, k), nvak, nvak, start);
+                if (info != 0) {
+                    plasma_request_fail(args->sequence, args->request,
+                                        A.nb*k+info);
+                    plasma_static_abort(plasma);
+                    return;
+                }
+                plasma_static_set(plasma, k, k, 1);
+            }
+            for (int m = k+1; m < A.nt; m++) {
+                if (plasma_static_owner(grid, k, m) == rank) {
+                    if (plasma_static_wait(plasma, k, k, 1))
+                        return;
+                    int nvam = plasma_tile_nview(A, m);
+                    uint64_t start = plasma_trace_start();
+                    plasma_core_ztrsm(
+                        PlasmaLeft, PlasmaUpper,
+                        PlasmaConjTrans, PlasmaNonUnit,
+                        A.nb, nvam,
+                        1.0, A(k, k), ldak,
+                             A(k, m), ldak);
+                    plasma_trace_stop("ztrsm", A(k, m), A.nb, nvam, start);
+                    plasma_static_set(plasma, k, m, 1);
+                }
+            }
+            for (int m = k+1; m < A.nt; m++) {
+                int nvam = plasma_tile_nview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+                if (plasma_static_owner(grid, m, m) == rank) {
+                    if (plasma_static_wait(plasma, k, m, 1))
+                        return;
+                    uint64_t start = plasma_trace_start();
+                    plasma_core_zherk(
+                        PlasmaUpper, PlasmaConjTrans,
+                        nvam, A.mb,
+                        -1.0, A(k, m), ldak,
+                         1.0, A(m, m), ldam);
+                    plasma_trace_stop("zherk", A(m, m), nvam, nvam, start);
+                }
+                for (int n = k+1; n < m; n++) {
+                    if (plasma_static_owner(grid, n, m) == rank) {
+                        if (plasma_static_wait(plasma, k, n, 1) ||
+                            plasma_static_wait(plasma, k, m, 1))
+                            return;
+                        int ldan = plasma_tile_mmain(A, n);
+                        uint64_t start = plasma_trace_start();
+                        plasma_core_zgemm(
+                            PlasmaConjTrans, PlasmaNoTrans,
+                            A.mb, nvam, A.mb,
+                            -1.0, A(k, n), ldak,
+                                  A(k, m), ldak,
+                             1.0, A(n, m), ldan);
+                        plasma_trace_stop("zgemm", A(n, m), A.mb, nvam, start);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile Cholesky factorization, statically scheduled.
+ *  Tiles are mapped 2D block-cyclically to the threads.
+ * @see plasma_omp_zpotrf
+ ******************************************************************************/
+void plasma_pzpotrf_static(plasma_enum_t uplo, plasma_desc_t A,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma_static_init(plasma, A.mt, A.nt) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    plasma_pzpotrf_static_args_t args = {
+        plasma, uplo, A, sequence, request
+    };
+    plasma_static_run(plasma_pzpotrf_static_worker, &args);
+
+    plasma_static_finalize(plasma);
+}
@@ -0,0 +1,218 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgeqrf_batch.c, normal z -> s, Sat Oct 17 13:39:37 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include <plasma_core_blas.h>
+
+#include <omp.h>
+
+/******************************************************************************/
+// Factors the matrices of the batch, the sizes of matrix i being m[i*inc],
+// n[i*inc] and lda[i*inc], i.e., inc = 0 for batches of matrices
+// of the same size.
+static int plasma_sgeqrf_batch_run(const int *m, const int *n, int inc,
+                                   float **pA, const int *lda,
+                                   float **pTau, int batch_count)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -6;
+    }
+    int num_sizes = inc == 0 ? 1 : batch_count;
+    if (num_sizes > 0 && (m == NULL || n == NULL || lda == NULL)) {
+        plasma_error("NULL sizes");
+        return PlasmaErrorNullParameter;
+    }
+    int nmax = 0;
+    for (int i = 0; i < num_sizes; i++) {
+        if (m[i] < 0) {
+            plasma_error("illegal value of m");
+            return -1;
+        }
+        if (n[i] < 0) {
+            plasma_error("illegal value of n");
+            return -2;
+        }
+        if (lda[i] < imax(1, m[i])) {
+            plasma_error("illegal value of lda");
+            return -4;
+        }
+        nmax = imax(nmax, n[i]);
+    }
+    if (batch_count > 0 && pA == NULL) {
+        plasma_error("NULL pA");
+        return -3;
+    }
+    if (batch_count > 0 && pTau == NULL) {
+        plasma_error("NULL pTau");
+        return -5;
+    }
+
+    // quick return
+    if (batch_count == 0 || nmax == 0)
+        return PlasmaSuccess;
+
+    // Set inner blocking from the context.
+    int ib = plasma->ib;
+
+    // Allocate workspace, per thread the T factor and the work of geqrt.
+    plasma_workspace_t work;
+    size_t lwork = 2*(size_t)ib*nmax;
+    int retval = plasma_workspace_create(&work, lwork, PlasmaRealFloat);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_workspace_create() failed");
+        return retval;
+    }
+
+    // Each matrix is factored by one task, a few tasks per thread
+    // balancing matrices of different sizes.
+    #pragma omp parallel
+    #pragma omp master
+    {
+        #pragma omp taskloop num_tasks(imin(batch_count, \
+                                            8*omp_get_num_threads()))
+        for (int i = 0; i < batch_count; i++) {
+            float *T =
+                (float*)work.spaces[omp_get_thread_num()];
+            float *W = T + (size_t)ib*nmax;
+            plasma_core_sgeqrt(m[i*inc], n[i*inc], ib,
+                               pA[i], lda[i*inc],
+                               T, ib,
+                               pTau[i], W);
+        }
+    }
+    // implicit synchronization
+
+    plasma_workspace_destroy(&work);
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Computes the QR factorizations of a batch of general matrices
+ *  of the same size,
+ *
+ *    \f[ A_i = Q_i \times R_i, \f]
+ *
+ *  in LAPACK layout, in one parallel region, each factorization by a task.
+ *  Suited to large numbers of small matrices.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrices. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices. n >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch_count pointers to the matrices.
+ *          On exit, R on and above the diagonal and the Householder
+ *          vectors below, as in LAPACK sgeqrf.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrices. lda >= max(1,m).
+ *
+ * @param[out] pTau
+ *          Array of batch_count pointers to arrays of min(m,n),
+ *          the scalar factors of the Householder reflectors.
+ *
+ * @param[in] batch_count
+ *          The number of matrices. batch_count >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgeqrf_vbatch
+ * @sa plasma_cgeqrf_batch
+ * @sa plasma_dgeqrf_batch
+ * @sa plasma_sgeqrf_batch
+ *
+ ******************************************************************************/
+int plasma_sgeqrf_batch(int m, int n,
+                        float **pA, int lda,
+                        float **pTau, int batch_count)
+{
+    return plasma_sgeqrf_batch_run(&m, &n, 0, pA, &lda, pTau, batch_count);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_geqrf
+ *
+ *  Computes the QR factorizations of a batch of general matrices
+ *  of different sizes.
+ *  Variable size version of plasma_sgeqrf_batch().
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          Array of batch_count, the numbers of rows of the matrices.
+ *          m[i] >= 0.
+ *
+ * @param[in] n
+ *          Array of batch_count, the numbers of columns of the matrices.
+ *          n[i] >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch_count pointers to the matrices.
+ *          On exit, R and the Householder vectors.
+ *
+ * @param[in] lda
+ *          Array of batch_count, the leading dimensions of the matrices.
+ *          lda[i] >= max(1,m[i]).
+ *
+ * @param[out] pTau
+ *          Array of batch_count pointers to arrays of min(m[i],n[i]),
+ *          the scalar factors of the Householder reflectors.
+ *
+ * @param[in] batch_count
+ *          The number of matrices. batch_count >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgeqrf_batch
+ * @sa plasma_cgeqrf_vbatch
+ * @sa plasma_dgeqrf_vbatch
+ * @sa plasma_sgeqrf_vbatch
+ *
+ ******************************************************************************/
+int plasma_sgeqrf_vbatch(const int *m, const int *n,
+                         float **pA, const int *lda,
+                         float **pTau, int batch_count)
+{
+    return plasma_sgeqrf_batch_run(m, n, 1, pA, lda, pTau, batch_count);
+}
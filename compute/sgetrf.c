@@ -0,0 +1,235 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgetrf.c, normal z -> s, Sat Oct 17 13:39:00 2026
+ *
+ **/
+
+#include "flops.h"
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_tuning.h"
+#include "plasma_types.h"
+#include "plasma_workspace.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ ******************************************************************************/
+int plasma_sgetrf(int m, int n,
+                  float *pA, int lda, int *ipiv)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    if (m < 0) {
+        plasma_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+
+    // quick return
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Time the call.
+    float stats = plasma_stats_start();
+
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune_getrf(plasma, PlasmaRealFloat, m, n);
+
+    // With PlasmaDryRun, record the task graph instead of running it.
+    if (plasma->dry_run == PlasmaEnabled) {
+        plasma_desc_t A;
+        plasma_desc_general_init(PlasmaRealFloat, NULL,
+                                 plasma->nb, plasma->nb,
+                                 m, n, 0, 0, m, n, &A);
+        return plasma_psgetrf_dryrun(A);
+    }
+
+    // Small problems skip tiling.
+    if (plasma_context_small(plasma, imax(m, n))) {
+        int info = LAPACKE_sgetrf_work(LAPACK_COL_MAJOR, m, n, pA, lda, ipiv);
+        plasma_stats_stop("sgetrf", flops_sgetrf(m, n), stats);
+        return info;
+    }
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Initialize barrier.
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
+
+    // Create tile matrix.
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_general_inplace_create(PlasmaRealFloat, pA, lda,
+                                                nb, nb, m, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_inplace_create() failed");
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    retval = plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    retval = plasma_request_init(&request);
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        // Translate to tile layout.
+        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_sgetrf(A, ipiv, &sequence, &request);
+    }
+
+    // If status/=0, matrix is singular don't copy back the factored matrix,
+    // unless it was translated in place.
+    if (sequence.status == 0 || A.inplace) {
+
+        // Translate back to LAPACK layout.
+        #pragma omp parallel
+        #pragma omp master
+        {
+            plasma_omp_sdesc2ge(A, pA, lda, &sequence, &request);
+        }
+    }
+    else {
+        plasma_request_fail(&sequence, &request, imin(m,n) + sequence.status);
+    }
+
+    // Free matrix A in tile layout.
+    plasma_desc_destroy(&A);
+
+    // Return status.
+    int status = sequence.status;
+    plasma_stats_stop("sgetrf", flops_sgetrf(m, n), stats);
+    return status;
+}
+
+/***************************************************************************//**
+ *
+ ******************************************************************************/
+void plasma_omp_sgetrf(plasma_desc_t A, int *ipiv,
+                       plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        plasma_error("invalid A");
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.m == 0 || A.n == 0)
+        return;
+
+    // Call the parallel function.
+    if (plasma->scheduling == PlasmaStaticScheduling)
+        plasma_psgetrf_static(A, ipiv, sequence, request);
+    else
+        plasma_psgetrf(A, ipiv, sequence, request);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Computes the LU factorization with partial pivoting of the matrix held
+ *  by a persistent handle. The factors are left in tile layout until
+ *  plasma_handle_sync() is called.
+ *
+ ******************************************************************************/
+int plasma_sgetrf_handle(plasma_handle_t *A, int *ipiv)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    if (plasma_handle_check(A, PlasmaRealFloat) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -1;
+    }
+
+    // quick return
+    int m = A->A.m;
+    int n = A->A.n;
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Initialize barrier.
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    plasma_request_init(&request);
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        // Translate to tile layout, if needed.
+        plasma_omp_handle_to_tile(A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_sgetrf(A->A, ipiv, &sequence, &request);
+    }
+
+    plasma_handle_tile_modified(A);
+
+    if (sequence.status != 0)
+        plasma_request_fail(&sequence, &request, imin(m,n) + sequence.status);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
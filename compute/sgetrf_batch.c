@@ -0,0 +1,211 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgetrf_batch.c, normal z -> s, Sat Oct 17 13:39:37 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/******************************************************************************/
+// Factors the matrices of the batch, the sizes of matrix i being m[i*inc],
+// n[i*inc] and lda[i*inc], i.e., inc = 0 for batches of matrices
+// of the same size.
+static int plasma_sgetrf_batch_run(const int *m, const int *n, int inc,
+                                   float **pA, const int *lda,
+                                   int **pipiv, int batch_count, int *info)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -6;
+    }
+    int num_sizes = inc == 0 ? 1 : batch_count;
+    if (num_sizes > 0 && (m == NULL || n == NULL || lda == NULL)) {
+        plasma_error("NULL sizes");
+        return PlasmaErrorNullParameter;
+    }
+    for (int i = 0; i < num_sizes; i++) {
+        if (m[i] < 0) {
+            plasma_error("illegal value of m");
+            return -1;
+        }
+        if (n[i] < 0) {
+            plasma_error("illegal value of n");
+            return -2;
+        }
+        if (lda[i] < imax(1, m[i])) {
+            plasma_error("illegal value of lda");
+            return -4;
+        }
+    }
+    if (batch_count > 0 && pA == NULL) {
+        plasma_error("NULL pA");
+        return -3;
+    }
+    if (batch_count > 0 && pipiv == NULL) {
+        plasma_error("NULL pipiv");
+        return -5;
+    }
+    if (batch_count > 0 && info == NULL) {
+        plasma_error("NULL info");
+        return -7;
+    }
+
+    // quick return
+    if (batch_count == 0)
+        return PlasmaSuccess;
+
+    // Each matrix is factored by one task, a few tasks per thread
+    // balancing matrices of different sizes.
+    #pragma omp parallel
+    #pragma omp master
+    {
+        #pragma omp taskloop num_tasks(imin(batch_count, \
+                                            8*omp_get_num_threads()))
+        for (int i = 0; i < batch_count; i++) {
+            info[i] = LAPACKE_sgetrf_work(LAPACK_COL_MAJOR,
+                                          m[i*inc], n[i*inc],
+                                          pA[i], lda[i*inc], pipiv[i]);
+        }
+    }
+    // implicit synchronization
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Computes the LU factorizations with partial pivoting of a batch
+ *  of general matrices of the same size,
+ *
+ *    \f[ A_i = P_i \times L_i \times U_i, \f]
+ *
+ *  in LAPACK layout, in one parallel region, each factorization by a task.
+ *  Suited to large numbers of small matrices.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrices. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices. n >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch_count pointers to the matrices.
+ *          On exit, the factors L and U, the unit diagonal of L
+ *          not being stored.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrices. lda >= max(1,m).
+ *
+ * @param[out] pipiv
+ *          Array of batch_count pointers to arrays of min(m,n),
+ *          the pivot indices of the factorizations, as in LAPACK.
+ *
+ * @param[in] batch_count
+ *          The number of matrices. batch_count >= 0.
+ *
+ * @param[out] info
+ *          Array of batch_count. info[i] = 0 if A_i was factored,
+ *          or j > 0 if U_i(j,j) is exactly zero.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgetrf_vbatch
+ * @sa plasma_cgetrf_batch
+ * @sa plasma_dgetrf_batch
+ * @sa plasma_sgetrf_batch
+ *
+ ******************************************************************************/
+int plasma_sgetrf_batch(int m, int n,
+                        float **pA, int lda, int **pipiv,
+                        int batch_count, int *info)
+{
+    return plasma_sgetrf_batch_run(&m, &n, 0, pA, &lda, pipiv,
+                                   batch_count, info);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Computes the LU factorizations with partial pivoting of a batch
+ *  of general matrices of different sizes.
+ *  Variable size version of plasma_sgetrf_batch().
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          Array of batch_count, the numbers of rows of the matrices.
+ *          m[i] >= 0.
+ *
+ * @param[in] n
+ *          Array of batch_count, the numbers of columns of the matrices.
+ *          n[i] >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch_count pointers to the matrices.
+ *          On exit, the factors L and U.
+ *
+ * @param[in] lda
+ *          Array of batch_count, the leading dimensions of the matrices.
+ *          lda[i] >= max(1,m[i]).
+ *
+ * @param[out] pipiv
+ *          Array of batch_count pointers to arrays of min(m[i],n[i]),
+ *          the pivot indices of the factorizations.
+ *
+ * @param[in] batch_count
+ *          The number of matrices. batch_count >= 0.
+ *
+ * @param[out] info
+ *          Array of batch_count, as in plasma_sgetrf_batch().
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgetrf_batch
+ * @sa plasma_cgetrf_vbatch
+ * @sa plasma_dgetrf_vbatch
+ * @sa plasma_sgetrf_vbatch
+ *
+ ******************************************************************************/
+int plasma_sgetrf_vbatch(const int *m, const int *n,
+                         float **pA, const int *lda, int **pipiv,
+                         int batch_count, int *info)
+{
+    return plasma_sgetrf_batch_run(m, n, 1, pA, lda, pipiv,
+                                   batch_count, info);
+}
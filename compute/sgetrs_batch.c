@@ -0,0 +1,238 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zgetrs_batch.c, normal z -> s, Sat Oct 17 13:39:37 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/******************************************************************************/
+// Solves the systems of the batch, the sizes of system i being n[i*inc],
+// nrhs[i*inc], lda[i*inc] and ldb[i*inc], i.e., inc = 0 for batches of
+// systems of the same size.
+static int plasma_sgetrs_batch_run(const int *n, const int *nrhs, int inc,
+                                   float **pA, const int *lda,
+                                   int **pipiv,
+                                   float **pB, const int *ldb,
+                                   int batch_count)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (batch_count < 0) {
+        plasma_error("illegal value of batch_count");
+        return -8;
+    }
+    int num_sizes = inc == 0 ? 1 : batch_count;
+    if (num_sizes > 0 &&
+        (n == NULL || nrhs == NULL || lda == NULL || ldb == NULL)) {
+        plasma_error("NULL sizes");
+        return PlasmaErrorNullParameter;
+    }
+    for (int i = 0; i < num_sizes; i++) {
+        if (n[i] < 0) {
+            plasma_error("illegal value of n");
+            return -1;
+        }
+        if (nrhs[i] < 0) {
+            plasma_error("illegal value of nrhs");
+            return -2;
+        }
+        if (lda[i] < imax(1, n[i])) {
+            plasma_error("illegal value of lda");
+            return -4;
+        }
+        if (ldb[i] < imax(1, n[i])) {
+            plasma_error("illegal value of ldb");
+            return -7;
+        }
+    }
+    if (batch_count > 0 && pA == NULL) {
+        plasma_error("NULL pA");
+        return -3;
+    }
+    if (batch_count > 0 && pipiv == NULL) {
+        plasma_error("NULL pipiv");
+        return -5;
+    }
+    if (batch_count > 0 && pB == NULL) {
+        plasma_error("NULL pB");
+        return -6;
+    }
+
+    // quick return
+    if (batch_count == 0)
+        return PlasmaSuccess;
+
+    // Each system is solved by one task, a few tasks per thread
+    // balancing systems of different sizes.
+    #pragma omp parallel
+    #pragma omp master
+    {
+        #pragma omp taskloop num_tasks(imin(batch_count, \
+                                            8*omp_get_num_threads()))
+        for (int i = 0; i < batch_count; i++) {
+            int ni = n[i*inc];
+            int nrhsi = nrhs[i*inc];
+            if (ni > 0 && nrhsi > 0) {
+                LAPACKE_slaswp_work(LAPACK_COL_MAJOR,
+                                    nrhsi, pB[i], ldb[i*inc],
+                                    1, ni, pipiv[i], 1);
+                plasma_core_strsm(PlasmaLeft, PlasmaLower,
+                                  PlasmaNoTrans, PlasmaUnit,
+                                  ni, nrhsi,
+                                  1.0, pA[i], lda[i*inc],
+                                       pB[i], ldb[i*inc]);
+                plasma_core_strsm(PlasmaLeft, PlasmaUpper,
+                                  PlasmaNoTrans, PlasmaNonUnit,
+                                  ni, nrhsi,
+                                  1.0, pA[i], lda[i*inc],
+                                       pB[i], ldb[i*inc]);
+            }
+        }
+    }
+    // implicit synchronization
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrs
+ *
+ *  Solves a batch of general systems of the same size,
+ *
+ *    \f[ A_i \times X_i = B_i, \f]
+ *
+ *  using the LU factorizations computed by plasma_sgetrf_batch(),
+ *  in LAPACK layout, in one parallel region, each system by a task.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrices. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides of each system. nrhs >= 0.
+ *
+ * @param[in] pA
+ *          Array of batch_count pointers to the factors L and U
+ *          computed by plasma_sgetrf_batch().
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrices A_i. lda >= max(1,n).
+ *
+ * @param[in] pipiv
+ *          Array of batch_count pointers to the pivot indices
+ *          computed by plasma_sgetrf_batch().
+ *
+ * @param[in,out] pB
+ *          Array of batch_count pointers to the right hand sides B_i.
+ *          On exit, the solutions X_i.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the matrices B_i. ldb >= max(1,n).
+ *
+ * @param[in] batch_count
+ *          The number of systems. batch_count >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgetrs_vbatch
+ * @sa plasma_cgetrs_batch
+ * @sa plasma_dgetrs_batch
+ * @sa plasma_sgetrs_batch
+ *
+ ******************************************************************************/
+int plasma_sgetrs_batch(int n, int nrhs,
+                        float **pA, int lda, int **pipiv,
+                        float **pB, int ldb,
+                        int batch_count)
+{
+    return plasma_sgetrs_batch_run(&n, &nrhs, 0, pA, &lda, pipiv, pB, &ldb,
+                                   batch_count);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrs
+ *
+ *  Solves a batch of general systems of different sizes.
+ *  Variable size version of plasma_sgetrs_batch().
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          Array of batch_count, the orders of the matrices. n[i] >= 0.
+ *
+ * @param[in] nrhs
+ *          Array of batch_count, the numbers of right hand sides.
+ *          nrhs[i] >= 0.
+ *
+ * @param[in] pA
+ *          Array of batch_count pointers to the factors L and U
+ *          computed by plasma_sgetrf_vbatch().
+ *
+ * @param[in] lda
+ *          Array of batch_count, the leading dimensions of the matrices A_i.
+ *          lda[i] >= max(1,n[i]).
+ *
+ * @param[in] pipiv
+ *          Array of batch_count pointers to the pivot indices
+ *          computed by plasma_sgetrf_vbatch().
+ *
+ * @param[in,out] pB
+ *          Array of batch_count pointers to the right hand sides B_i.
+ *          On exit, the solutions X_i.
+ *
+ * @param[in] ldb
+ *          Array of batch_count, the leading dimensions of the matrices B_i.
+ *          ldb[i] >= max(1,n[i]).
+ *
+ * @param[in] batch_count
+ *          The number of systems. batch_count >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_sgetrs_batch
+ * @sa plasma_cgetrs_vbatch
+ * @sa plasma_dgetrs_vbatch
+ * @sa plasma_sgetrs_vbatch
+ *
+ ******************************************************************************/
+int plasma_sgetrs_vbatch(const int *n, const int *nrhs,
+                         float **pA, const int *lda, int **pipiv,
+                         float **pB, const int *ldb,
+                         int batch_count)
+{
+    return plasma_sgetrs_batch_run(n, nrhs, 1, pA, lda, pipiv, pB, ldb,
+                                   batch_count);
+}
@@ -156,7 +156,7 @@ int plasma_zcgbsv(int n, int kl, int ku, int nrhs,
     int nb = plasma->nb;
 
     // Initialize barrier
-    plasma_barrier_init(&plasma->barrier);
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
 
     // Create tile matrices.
     plasma_desc_t AB;
@@ -243,7 +243,7 @@ int plasma_zcgbsv(int n, int kl, int ku, int nrhs,
     retval = plasma_request_init(&request);
 
     // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
 
     // asynchronous block
     #pragma omp parallel
@@ -225,7 +225,7 @@ int plasma_zcgesv(int n, int nrhs,
     retval = plasma_request_init(&request);
 
     // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
 
     // asynchronous block
     #pragma omp parallel
@@ -22,7 +22,8 @@
     @ingroup plasma_ccrb2cm
 
     Convert tiled (CCRB) to column-major (CM) matrix layout.
-    Out-of-place.
+    Out-of-place, unless A was created in-place
+    by plasma_desc_general_inplace_create() on pA.
 */
 void plasma_omp_zdesc2ge(plasma_desc_t A,
                          plasma_complex64_t *pA, int lda,
@@ -58,11 +59,19 @@ void plasma_omp_zdesc2ge(plasma_desc_t A,
         plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
         return;
     }
+    if (A.inplace && (A.matrix != pA || lda != A.gm)) {
+        plasma_error("in-place A does not alias pA");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
 
     // quick return
     if (A.m == 0 || A.n == 0)
         return;
 
     // Call the parallel function.
-    plasma_pzdesc2ge(A, pA, lda, sequence, request);
+    if (A.inplace)
+        plasma_pdesc2ge_inplace(A, sequence, request);
+    else
+        plasma_pzdesc2ge(A, pA, lda, sequence, request);
 }
@@ -109,7 +109,7 @@ int plasma_zgbsv(int n, int kl, int ku, int nrhs,
     int nb = plasma->nb;
 
     // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
 
     // Create tile matrix.
     plasma_desc_t AB;
@@ -94,7 +94,7 @@ int plasma_zgbtrf(int m, int n, int kl, int ku,
     int nb = plasma->nb;
 
     // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
 
     // Create tile matrix.
     plasma_desc_t AB;
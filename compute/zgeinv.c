@@ -94,7 +94,7 @@ int plasma_zgeinv(int m, int n, plasma_complex64_t *pA, int lda, int *ipiv)
     int nb = plasma->nb;
 
     // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
 
     // Create tile matrix.
     plasma_desc_t A;
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -97,6 +98,9 @@ int plasma_zgelqf(int m, int n,
     if (imin(m, n) == 0)
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_gelqf(plasma, PlasmaComplexDouble, m, n);
@@ -162,6 +166,7 @@ int plasma_zgelqf(int m, int n,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zgelqf", flops_zgelqf(m, n), stats);
     return status;
 }
 
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -18,6 +19,9 @@
 #include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
+#include <plasma_core_blas.h>
+
+#include <omp.h>
 
 /***************************************************************************//**
  *
@@ -177,10 +181,32 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
     if (m == 0 || n == 0 || ((alpha == 0.0 || k == 0) && beta == 1.0))
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_gemm(plasma, PlasmaComplexDouble, m, n, k);
 
+    // Small problems skip tiling, the columns of C split over a team.
+    if (plasma_context_small(plasma, imax(imax(m, n), k))) {
+        int team = imin(plasma->small_threads, n);
+        #pragma omp parallel num_threads(team) if (team > 1)
+        {
+            int size = omp_get_num_threads();
+            int rank = omp_get_thread_num();
+            int j0 = n*rank/size;
+            int jn = n*(rank+1)/size-j0;
+            size_t offsetb = transb == PlasmaNoTrans ? (size_t)ldb*j0 : j0;
+            plasma_core_zgemm(transa, transb, m, jn, k,
+                              alpha, pA, lda,
+                                     &pB[offsetb], ldb,
+                              beta,  &pC[(size_t)ldc*j0], ldc);
+        }
+        plasma_stats_stop("zgemm", flops_zgemm(m, n, k), stats);
+        return PlasmaSuccess;
+    }
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -189,23 +215,26 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
     plasma_desc_t B;
     plasma_desc_t C;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        am, an, 0, 0, am, an, &A);
+    // B may alias A, in which case neither is translated in place.
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble,
+                                                pA == pB ? NULL : pA, lda,
+                                                nb, nb, am, an, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        bm, bn, 0, 0, bm, bn, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble,
+                                                pB == pA ? NULL : pB, ldb,
+                                                nb, nb, bm, bn, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &C);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pC, ldc,
+                                                nb, nb, m, n, &C);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         plasma_desc_destroy(&B);
         return retval;
@@ -237,6 +266,10 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
 
         // Translate back to LAPACK layout.
         plasma_omp_zdesc2ge(C, pC, ldc, &sequence, &request);
+        if (A.inplace)
+            plasma_omp_zdesc2ge(A, pA, lda, &sequence, &request);
+        if (B.inplace)
+            plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
@@ -247,6 +280,7 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zgemm", flops_zgemm(m, n, k), stats);
     return status;
 }
 
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -99,6 +100,9 @@ int plasma_zgeqrf(int m, int n,
     if (imin(m, n) == 0)
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_geqrf(plasma, PlasmaComplexDouble, m, n);
@@ -108,6 +112,20 @@ int plasma_zgeqrf(int m, int n,
     int nb = plasma->nb;
     plasma_enum_t householder_mode = plasma->householder_mode;
 
+    // With PlasmaDryRun, record the task graph instead of running it.
+    // T is still created, so that it can be destroyed as usual.
+    if (plasma->dry_run == PlasmaEnabled) {
+        plasma_desc_t A;
+        plasma_desc_general_init(PlasmaComplexDouble, NULL, nb, nb,
+                                 m, n, 0, 0, m, n, &A);
+        int retval = plasma_descT_create(A, ib, householder_mode, T);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_descT_create() failed");
+            return retval;
+        }
+        return plasma_pzgeqrf_dryrun(A, ib);
+    }
+
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
@@ -164,6 +182,7 @@ int plasma_zgeqrf(int m, int n,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zgeqrf", flops_zgeqrf(m, n), stats);
     return status;
 }
 
@@ -262,6 +281,9 @@ void plasma_omp_zgeqrf(plasma_desc_t A, plasma_desc_t T,
     if (plasma->householder_mode == PlasmaTreeHouseholder) {
         plasma_pzgeqrf_tree(A, T, work, sequence, request);
     }
+    else if (plasma->scheduling == PlasmaStaticScheduling) {
+        plasma_pzgeqrf_static(A, T, work, sequence, request);
+    }
     else {
         plasma_pzgeqrf(A, T, work, sequence, request);
     }
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -107,6 +108,9 @@ int plasma_zgeqrs(int m, int n, int nrhs,
     if (m == 0 || n == 0 || nrhs == 0)
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_geqrf(plasma, PlasmaComplexDouble, m, n);
@@ -174,6 +178,7 @@ int plasma_zgeqrs(int m, int n, int nrhs,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zgeqrs", flops_zgeqrs(m, n, nrhs), stats);
     return status;
 }
 
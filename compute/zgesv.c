@@ -10,14 +10,20 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
+#include "plasma_future.h"
 #include "plasma_internal.h"
 #include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+#include <stdlib.h>
 
 /***************************************************************************//**
  *
@@ -54,30 +60,57 @@ int plasma_zgesv(int n, int nrhs,
     if (imin(n, nrhs) == 0)
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_getrf(plasma, PlasmaComplexDouble, n, n);
 
+    // Small problems skip tiling, the right-hand sides split over a team.
+    if (plasma_context_small(plasma, n)) {
+        int info = LAPACKE_zgetrf_work(LAPACK_COL_MAJOR, n, n, pA, lda, ipiv);
+        if (info != 0) {
+            plasma_stats_stop("zgesv",
+                              flops_zgetrf(n, n)+flops_zgetrs(n, nrhs), stats);
+            return info;
+        }
+
+        int team = imin(plasma->small_threads, nrhs);
+        #pragma omp parallel num_threads(team) if (team > 1)
+        {
+            int size = omp_get_num_threads();
+            int rank = omp_get_thread_num();
+            int j0 = nrhs*rank/size;
+            int jn = nrhs*(rank+1)/size-j0;
+            LAPACKE_zgetrs_work(LAPACK_COL_MAJOR, 'N', n, jn, pA, lda, ipiv,
+                                &pB[(size_t)ldb*j0], ldb);
+        }
+        plasma_stats_stop("zgesv",
+                          flops_zgetrf(n, n)+flops_zgetrs(n, nrhs), stats);
+        return PlasmaSuccess;
+    }
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
     // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
 
     // Create tile matrix.
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, n, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, n, nrhs, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
 
@@ -110,9 +143,90 @@ int plasma_zgesv(int n, int nrhs,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zgesv", flops_zgetrf(n, n)+flops_zgetrs(n, nrhs), stats);
     return status;
 }
 
+/******************************************************************************/
+// Arguments of plasma_zgesv() queued by plasma_zgesv_async().
+typedef struct {
+    int n;
+    int nrhs;
+    plasma_complex64_t *pA;
+    int lda;
+    int *ipiv;
+    plasma_complex64_t *pB;
+    int ldb;
+} plasma_zgesv_args_t;
+
+/******************************************************************************/
+static int plasma_zgesv_run(void *args)
+{
+    plasma_zgesv_args_t *a = (plasma_zgesv_args_t*)args;
+    return plasma_zgesv(a->n, a->nrhs, a->pA, a->lda, a->ipiv, a->pB, a->ldb);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gesv
+ *
+ *  Asynchronous version of plasma_zgesv().
+ *  Returns once the call is queued. The solve runs on a thread and
+ *  OpenMP team owned by PLASMA, with the settings of the calling thread's
+ *  context at the time of the call, so the caller can go on preparing
+ *  the next system. A, ipiv and B must not be accessed until the call
+ *  completes.
+ *
+ *******************************************************************************
+ *
+ * @param[in] callback
+ *          Called with the return value of plasma_zgesv() when the solve
+ *          completes, before the future completes. May be NULL.
+ *
+ * @param[in] data
+ *          Passed to callback.
+ *
+ * @param[out] future
+ *          On exit, the future of the call. Its completion is checked by
+ *          plasma_future_test() and plasma_future_wait(), which returns the
+ *          return value of plasma_zgesv(). Freed by plasma_future_destroy().
+ *
+ *  The other arguments are the ones of plasma_zgesv().
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess if the call was queued
+ * @retval  < 0 if it could not be queued
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgesv
+ * @sa plasma_future_wait
+ *
+ ******************************************************************************/
+int plasma_zgesv_async(int n, int nrhs,
+                       plasma_complex64_t *pA, int lda, int *ipiv,
+                       plasma_complex64_t *pB, int ldb,
+                       plasma_callback_t callback, void *data,
+                       plasma_future_t **future)
+{
+    plasma_zgesv_args_t *args =
+        (plasma_zgesv_args_t*)malloc(sizeof(plasma_zgesv_args_t));
+    if (args == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    args->n = n;
+    args->nrhs = nrhs;
+    args->pA = pA;
+    args->lda = lda;
+    args->ipiv = ipiv;
+    args->pB = pB;
+    args->ldb = ldb;
+
+    return plasma_future_submit(plasma_zgesv_run, args, callback, data, future);
+}
+
 /***************************************************************************//**
  *
  ******************************************************************************/
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -18,6 +19,7 @@
 #include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
+#include "core_lapack.h"
 
 /***************************************************************************//**
  *
@@ -49,23 +51,42 @@ int plasma_zgetrf(int m, int n,
     if (imin(m, n) == 0)
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_getrf(plasma, PlasmaComplexDouble, m, n);
 
+    // With PlasmaDryRun, record the task graph instead of running it.
+    if (plasma->dry_run == PlasmaEnabled) {
+        plasma_desc_t A;
+        plasma_desc_general_init(PlasmaComplexDouble, NULL,
+                                 plasma->nb, plasma->nb,
+                                 m, n, 0, 0, m, n, &A);
+        return plasma_pzgetrf_dryrun(A);
+    }
+
+    // Small problems skip tiling.
+    if (plasma_context_small(plasma, imax(m, n))) {
+        int info = LAPACKE_zgetrf_work(LAPACK_COL_MAJOR, m, n, pA, lda, ipiv);
+        plasma_stats_stop("zgetrf", flops_zgetrf(m, n), stats);
+        return info;
+    }
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
     // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
 
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, m, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
 
@@ -87,8 +108,9 @@ int plasma_zgetrf(int m, int n,
         plasma_omp_zgetrf(A, ipiv, &sequence, &request);
     }
 
-    // If status/=0, matrix is singular don't copy back the factored matrix.
-    if (sequence.status == 0) {
+    // If status/=0, matrix is singular don't copy back the factored matrix,
+    // unless it was translated in place.
+    if (sequence.status == 0 || A.inplace) {
 
         // Translate back to LAPACK layout.
         #pragma omp parallel
@@ -106,6 +128,7 @@ int plasma_zgetrf(int m, int n,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zgetrf", flops_zgetrf(m, n), stats);
     return status;
 }
 
@@ -145,5 +168,68 @@ void plasma_omp_zgetrf(plasma_desc_t A, int *ipiv,
         return;
 
     // Call the parallel function.
-    plasma_pzgetrf(A, ipiv, sequence, request);
+    if (plasma->scheduling == PlasmaStaticScheduling)
+        plasma_pzgetrf_static(A, ipiv, sequence, request);
+    else
+        plasma_pzgetrf(A, ipiv, sequence, request);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Computes the LU factorization with partial pivoting of the matrix held
+ *  by a persistent handle. The factors are left in tile layout until
+ *  plasma_handle_sync() is called.
+ *
+ ******************************************************************************/
+int plasma_zgetrf_handle(plasma_handle_t *A, int *ipiv)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    if (plasma_handle_check(A, PlasmaComplexDouble) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -1;
+    }
+
+    // quick return
+    int m = A->A.m;
+    int n = A->A.n;
+    if (imin(m, n) == 0)
+        return PlasmaSuccess;
+
+    // Initialize barrier.
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    plasma_request_init(&request);
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        // Translate to tile layout, if needed.
+        plasma_omp_handle_to_tile(A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_zgetrf(A->A, ipiv, &sequence, &request);
+    }
+
+    plasma_handle_tile_modified(A);
+
+    if (sequence.status != 0)
+        plasma_request_fail(&sequence, &request, imin(m,n) + sequence.status);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
 }
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -77,6 +78,9 @@ int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv)
     if (imax(n, 0) == 0)
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_getrf(plasma, PlasmaComplexDouble, n, n);
@@ -131,6 +135,7 @@ int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv)
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zgetri", flops_zgetri(n), stats);
     return status;
 }
 
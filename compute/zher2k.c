@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -163,6 +164,9 @@ int plasma_zher2k(plasma_enum_t uplo, plasma_enum_t trans,
     if (n == 0 || ((alpha == 0.0 || k == 0.0) && beta == 1.0))
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_syr2k(plasma, PlasmaComplexDouble, n, k);
@@ -233,6 +237,7 @@ int plasma_zher2k(plasma_enum_t uplo, plasma_enum_t trans,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zher2k", flops_zher2k(n, k), stats);
     return status;
 }
 
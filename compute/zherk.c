@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -139,6 +140,9 @@ int plasma_zherk(plasma_enum_t uplo, plasma_enum_t trans,
     if (n == 0 || ((alpha == 0.0 || k == 0) && beta == 1.0))
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_syrk(plasma, PlasmaComplexDouble, n, k);
@@ -197,6 +201,7 @@ int plasma_zherk(plasma_enum_t uplo, plasma_enum_t trans,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zherk", flops_zherk(n, k), stats);
     return status;
 }
 
@@ -142,7 +142,7 @@ int plasma_zhesv(plasma_enum_t uplo, int n, int nrhs,
     plasma->max_panel_threads  = max_panel_threads_hetrf;
 
     // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
+    plasma_barrier_init(&plasma->barrier, plasma->barrier_mode);
 
     // Initialize tile matrix descriptors.
     plasma_desc_t A;
@@ -195,8 +195,8 @@ int plasma_zhesv(plasma_enum_t uplo, int n, int nrhs,
     retval = plasma_request_init(&request);
 
     // Initialize data.
-    memset(T.matrix, 0, ldt*n*sizeof(plasma_complex64_t));
-    memset(W.matrix, 0, ldw*nb*sizeof(plasma_complex64_t));
+    memset(T.matrix, 0, plasma_desc_size(T)*sizeof(plasma_complex64_t));
+    memset(W.matrix, 0, plasma_desc_size(W)*sizeof(plasma_complex64_t));
     for (int i = 0; i < nb; i++) ipiv[i] = 1+i;
 
     // asynchronous block
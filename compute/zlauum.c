@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -91,6 +92,9 @@ int plasma_zlauum(plasma_enum_t uplo, int n,
     if (imax(n, 0) == 0)
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_lauum(plasma, PlasmaComplexDouble, n);
@@ -136,6 +140,7 @@ int plasma_zlauum(plasma_enum_t uplo, int n,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zlauum", flops_zlauum(n), stats);
     return status;
 }
 
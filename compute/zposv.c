@@ -10,14 +10,21 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
+#include "plasma_future.h"
 #include "plasma_internal.h"
 #include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <omp.h>
+#include <stdlib.h>
 
 /***************************************************************************//**
  *
@@ -126,10 +133,38 @@ int plasma_zposv(plasma_enum_t uplo,
     if (imin(n, nrhs) == 0)
        return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_potrf(plasma, PlasmaComplexDouble, n);
 
+    // Small problems skip tiling, the right-hand sides split over a team.
+    if (plasma_context_small(plasma, n)) {
+        int info = plasma_core_zpotrf(uplo, n, pA, lda);
+        if (info != 0) {
+            plasma_stats_stop("zposv",
+                              flops_zpotrf(n)+flops_zpotrs(n, nrhs), stats);
+            return info;
+        }
+
+        int team = imin(plasma->small_threads, nrhs);
+        #pragma omp parallel num_threads(team) if (team > 1)
+        {
+            int size = omp_get_num_threads();
+            int rank = omp_get_thread_num();
+            int j0 = nrhs*rank/size;
+            int jn = nrhs*(rank+1)/size-j0;
+            LAPACKE_zpotrs_work(LAPACK_COL_MAJOR, lapack_const(uplo),
+                                n, jn, pA, lda,
+                                &pB[(size_t)ldb*j0], ldb);
+        }
+        plasma_stats_stop("zposv",
+                          flops_zpotrf(n)+flops_zpotrs(n, nrhs), stats);
+        return PlasmaSuccess;
+    }
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -143,10 +178,10 @@ int plasma_zposv(plasma_enum_t uplo,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, n, nrhs, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
@@ -182,9 +217,88 @@ int plasma_zposv(plasma_enum_t uplo,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zposv", flops_zpotrf(n)+flops_zpotrs(n, nrhs), stats);
     return status;
 }
 
+/******************************************************************************/
+// Arguments of plasma_zposv() queued by plasma_zposv_async().
+typedef struct {
+    plasma_enum_t uplo;
+    int n;
+    int nrhs;
+    plasma_complex64_t *pA;
+    int lda;
+    plasma_complex64_t *pB;
+    int ldb;
+} plasma_zposv_args_t;
+
+/******************************************************************************/
+static int plasma_zposv_run(void *args)
+{
+    plasma_zposv_args_t *a = (plasma_zposv_args_t*)args;
+    return plasma_zposv(a->uplo, a->n, a->nrhs, a->pA, a->lda, a->pB, a->ldb);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_posv
+ *
+ *  Asynchronous version of plasma_zposv().
+ *  Returns once the call is queued. The solve runs on a thread and
+ *  OpenMP team owned by PLASMA, with the settings of the calling thread's
+ *  context at the time of the call. A and B must not be accessed until
+ *  the call completes.
+ *
+ *******************************************************************************
+ *
+ * @param[in] callback
+ *          Called with the return value of plasma_zposv() when the solve
+ *          completes, before the future completes. May be NULL.
+ *
+ * @param[in] data
+ *          Passed to callback.
+ *
+ * @param[out] future
+ *          On exit, the future of the call, as for plasma_zgesv_async().
+ *
+ *  The other arguments are the ones of plasma_zposv().
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess if the call was queued
+ * @retval  < 0 if it could not be queued
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zposv
+ * @sa plasma_future_wait
+ *
+ ******************************************************************************/
+int plasma_zposv_async(plasma_enum_t uplo,
+                       int n, int nrhs,
+                       plasma_complex64_t *pA, int lda,
+                       plasma_complex64_t *pB, int ldb,
+                       plasma_callback_t callback, void *data,
+                       plasma_future_t **future)
+{
+    plasma_zposv_args_t *args =
+        (plasma_zposv_args_t*)malloc(sizeof(plasma_zposv_args_t));
+    if (args == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    args->uplo = uplo;
+    args->n = n;
+    args->nrhs = nrhs;
+    args->pA = pA;
+    args->lda = lda;
+    args->pB = pB;
+    args->ldb = ldb;
+
+    return plasma_future_submit(plasma_zposv_run, args, callback, data, future);
+}
+
 /***************************************************************************//**
  *
  * @ingroup plasma_posv
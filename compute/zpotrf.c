@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -18,6 +19,7 @@
 #include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
+#include <plasma_core_blas.h>
 
 /***************************************************************************//**
  *
@@ -101,10 +103,29 @@ int plasma_zpotrf(plasma_enum_t uplo,
     if (imax(n, 0) == 0)
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_potrf(plasma, PlasmaComplexDouble, n);
 
+    // With PlasmaDryRun, record the task graph instead of running it.
+    if (plasma->dry_run == PlasmaEnabled) {
+        plasma_desc_t A;
+        plasma_desc_general_init(PlasmaComplexDouble, NULL,
+                                 plasma->nb, plasma->nb,
+                                 n, n, 0, 0, n, n, &A);
+        return plasma_pzpotrf_dryrun(uplo, A);
+    }
+
+    // Small problems skip tiling.
+    if (plasma_context_small(plasma, n)) {
+        int info = plasma_core_zpotrf(uplo, n, pA, lda);
+        plasma_stats_stop("zpotrf", flops_zpotrf(n), stats);
+        return info;
+    }
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -146,6 +167,7 @@ int plasma_zpotrf(plasma_enum_t uplo,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zpotrf", flops_zpotrf(n), stats);
     return status;
 }
 
@@ -242,5 +264,99 @@ void plasma_omp_zpotrf(plasma_enum_t uplo, plasma_desc_t A,
         return;
 
     // Call the parallel function.
-    plasma_pzpotrf(uplo, A, sequence, request);
+    if (plasma->scheduling == PlasmaStaticScheduling)
+        plasma_pzpotrf_static(uplo, A, sequence, request);
+    else
+        plasma_pzpotrf(uplo, A, sequence, request);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the Cholesky factorization of a Hermitian positive definite
+ *  matrix held by a persistent handle.
+ *  The matrix is translated to tile layout only if the LAPACK copy changed
+ *  since the last call, and the factor is left in tile layout until
+ *  plasma_handle_sync() is called.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangle of A is stored;
+ *          - PlasmaLower: Lower triangle of A is stored.
+ *
+ * @param[in,out] A
+ *          Handle of the n-by-n Hermitian positive definite matrix A,
+ *          created by plasma_handle_create().
+ *          On exit, holds the factor U or L from the Cholesky
+ *          factorization A = U^H*U or A = L*L^H.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval  > 0 if i, the leading minor of order i of A is not
+ *          positive definite, so the factorization could not
+ *          be completed.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zpotrf
+ * @sa plasma_zpotrs_handle
+ *
+ ******************************************************************************/
+int plasma_zpotrf_handle(plasma_enum_t uplo, plasma_handle_t *A)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (plasma_handle_check(A, PlasmaComplexDouble) != PlasmaSuccess) {
+        plasma_error("invalid A");
+        return -2;
+    }
+    if (A->A.m != A->A.n) {
+        plasma_error("A is not square");
+        return -2;
+    }
+
+    // quick return
+    if (A->A.n == 0)
+        return PlasmaSuccess;
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    plasma_request_init(&request);
+
+    // asynchronous block
+    #pragma omp parallel
+    #pragma omp master
+    {
+        // Translate to tile layout, if needed.
+        plasma_omp_handle_to_tile(A, &sequence, &request);
+
+        // Call the tile async function.
+        plasma_omp_zpotrf(uplo, A->A, &sequence, &request);
+    }
+    // implicit synchronization
+
+    plasma_handle_tile_modified(A);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
 }
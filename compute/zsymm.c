@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -148,6 +149,9 @@ int plasma_zsymm(plasma_enum_t side, plasma_enum_t uplo,
     if (m == 0 || n == 0 || (alpha == 0.0 && beta == 1.0))
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_symm(plasma, PlasmaComplexDouble, m, n);
@@ -218,6 +222,7 @@ int plasma_zsymm(plasma_enum_t side, plasma_enum_t uplo,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zsymm", flops_zsymm(side, m, n), stats);
     return status;
 }
 
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -141,6 +142,9 @@ int plasma_zsyrk(plasma_enum_t uplo, plasma_enum_t trans,
     if (n == 0 || ((alpha == 0.0 || k == 0) && beta == 1.0))
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_syrk(plasma, PlasmaComplexDouble, n, k);
@@ -199,6 +203,7 @@ int plasma_zsyrk(plasma_enum_t uplo, plasma_enum_t trans,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zsyrk", flops_zsyrk(n, k), stats);
     return status;
 }
 
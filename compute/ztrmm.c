@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -165,6 +166,9 @@ int plasma_ztrmm(plasma_enum_t side, plasma_enum_t uplo,
     if (imin(m, n) == 0)
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_trmm(plasma, PlasmaComplexDouble, m, n);
@@ -222,6 +226,7 @@ int plasma_ztrmm(plasma_enum_t side, plasma_enum_t uplo,
     plasma_desc_destroy(&B);
 
     // Return status.
+    plasma_stats_stop("ztrmm", flops_ztrmm(side, m, n), stats);
     return sequence.status;
 }
 
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -164,6 +165,9 @@ int plasma_ztrsm(plasma_enum_t side, plasma_enum_t uplo,
     if ((m == 0) || (n == 0))
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
       plasma_tune_trsm(plasma, PlasmaComplexDouble, m, n);
@@ -222,6 +226,7 @@ int plasma_ztrsm(plasma_enum_t side, plasma_enum_t uplo,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("ztrsm", flops_ztrsm(side, m, n), stats);
     return status;
 }
 
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -98,6 +99,9 @@ int plasma_ztrtri(plasma_enum_t uplo, plasma_enum_t diag,
     if (imax(n, 0) == 0)
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_trtri(plasma, PlasmaComplexDouble, n);
@@ -143,6 +147,7 @@ int plasma_ztrtri(plasma_enum_t uplo, plasma_enum_t diag,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("ztrtri", flops_ztrtri(n), stats);
     return status;
 }
 
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -108,6 +109,9 @@ int plasma_zungqr(int m, int n, int k,
     if (n <= 0)
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_geqrf(plasma, PlasmaComplexDouble, m, n);
@@ -175,6 +179,7 @@ int plasma_zungqr(int m, int n, int k,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zungqr", flops_zungqr(m, n, k), stats);
     return status;
 }
 
@@ -10,6 +10,7 @@
  *
  **/
 
+#include "flops.h"
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
@@ -150,6 +151,9 @@ int plasma_zunmqr(plasma_enum_t side, plasma_enum_t trans,
     if (m == 0 || n == 0 || k == 0)
         return PlasmaSuccess;
 
+    // Time the call.
+    double stats = plasma_stats_start();
+
     // Tune parameters.
     if (plasma->tuning)
         plasma_tune_geqrf(plasma, PlasmaComplexDouble, m, n);
@@ -219,6 +223,7 @@ int plasma_zunmqr(plasma_enum_t side, plasma_enum_t trans,
 
     // Return status.
     int status = sequence.status;
+    plasma_stats_stop("zunmqr", flops_zunmqr(side, m, n, k), stats);
     return status;
 }
 
@@ -0,0 +1,373 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_tuning.h"
+#include "plasma_types.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+/******************************************************************************/
+// Routines tuned by plasma_autotune() and the parameters they take.
+enum {
+    PlasmaAutotuneGemm,
+    PlasmaAutotuneGelqf,
+    PlasmaAutotuneGeqrf,
+    PlasmaAutotuneGetrf,
+    PlasmaAutotunePotrf
+};
+
+static const struct {
+    const char *name;
+    int ib;                // tunes ib
+    int panel_threads;     // tunes max_panel_threads
+    int small;             // tunes PlasmaSmallSize
+} plasma_autotune_routines_g[] = {
+    { "gemm",  0, 0, 1 },
+    { "gelqf", 1, 0, 0 },
+    { "geqrf", 1, 0, 0 },
+    { "getrf", 1, 1, 1 },
+    { "potrf", 0, 0, 1 }
+};
+
+static const int plasma_autotune_nb_g[] =
+    { 32, 48, 64, 96, 128, 160, 192, 256, 320, 384, 512 };
+
+static const int plasma_autotune_ib_g[] =
+    { 8, 16, 24, 32, 48, 64, 96, 128 };
+
+// Number of timed runs of each candidate, the fastest one counting.
+#define PLASMA_AUTOTUNE_RUNS 3
+
+/******************************************************************************/
+// Sets A to a symmetric, diagonally dominant n-by-n matrix, with zero
+// imaginary parts, so that all routines can run on it.
+static void plasma_autotune_fill(plasma_enum_t dtyp, void *A, int n)
+{
+    unsigned int seed = 1;
+    for (int j = 0; j < n; j++) {
+        for (int i = j; i < n; i++) {
+            seed = seed*1103515245 + 12345;
+            double value = (double)((seed >> 16) & 0x7fff) / 0x7fff;
+            if (i == j)
+                value += n;
+            size_t ij = i + (size_t)n*j;
+            size_t ji = j + (size_t)n*i;
+            switch (dtyp) {
+            case PlasmaRealFloat:
+                ((float*)A)[ij] = ((float*)A)[ji] = value;
+                break;
+            case PlasmaRealDouble:
+                ((double*)A)[ij] = ((double*)A)[ji] = value;
+                break;
+            case PlasmaComplexFloat:
+                ((plasma_complex32_t*)A)[ij] =
+                ((plasma_complex32_t*)A)[ji] = value;
+                break;
+            case PlasmaComplexDouble:
+                ((plasma_complex64_t*)A)[ij] =
+                ((plasma_complex64_t*)A)[ji] = value;
+                break;
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Calls the driver of the routine once.
+static int plasma_autotune_call(int routine, plasma_enum_t dtyp, int n,
+                                void *A, void *B, void *C, int *ipiv)
+{
+    plasma_desc_t T;
+    int retval = PlasmaErrorNotSupported;
+    switch (routine) {
+    case PlasmaAutotuneGemm:
+        switch (dtyp) {
+        case PlasmaRealFloat:
+            return plasma_sgemm(PlasmaNoTrans, PlasmaNoTrans, n, n, n,
+                                1.0, A, n, B, n, 0.0, C, n);
+        case PlasmaRealDouble:
+            return plasma_dgemm(PlasmaNoTrans, PlasmaNoTrans, n, n, n,
+                                1.0, A, n, B, n, 0.0, C, n);
+        case PlasmaComplexFloat:
+            return plasma_cgemm(PlasmaNoTrans, PlasmaNoTrans, n, n, n,
+                                1.0, A, n, B, n, 0.0, C, n);
+        case PlasmaComplexDouble:
+            return plasma_zgemm(PlasmaNoTrans, PlasmaNoTrans, n, n, n,
+                                1.0, A, n, B, n, 0.0, C, n);
+        }
+        break;
+    case PlasmaAutotuneGelqf:
+        switch (dtyp) {
+        case PlasmaRealFloat:     retval = plasma_sgelqf(n, n, A, n, &T); break;
+        case PlasmaRealDouble:    retval = plasma_dgelqf(n, n, A, n, &T); break;
+        case PlasmaComplexFloat:  retval = plasma_cgelqf(n, n, A, n, &T); break;
+        case PlasmaComplexDouble: retval = plasma_zgelqf(n, n, A, n, &T); break;
+        }
+        if (retval == PlasmaSuccess)
+            plasma_desc_destroy(&T);
+        return retval;
+    case PlasmaAutotuneGeqrf:
+        switch (dtyp) {
+        case PlasmaRealFloat:     retval = plasma_sgeqrf(n, n, A, n, &T); break;
+        case PlasmaRealDouble:    retval = plasma_dgeqrf(n, n, A, n, &T); break;
+        case PlasmaComplexFloat:  retval = plasma_cgeqrf(n, n, A, n, &T); break;
+        case PlasmaComplexDouble: retval = plasma_zgeqrf(n, n, A, n, &T); break;
+        }
+        if (retval == PlasmaSuccess)
+            plasma_desc_destroy(&T);
+        return retval;
+    case PlasmaAutotuneGetrf:
+        switch (dtyp) {
+        case PlasmaRealFloat:     return plasma_sgetrf(n, n, A, n, ipiv);
+        case PlasmaRealDouble:    return plasma_dgetrf(n, n, A, n, ipiv);
+        case PlasmaComplexFloat:  return plasma_cgetrf(n, n, A, n, ipiv);
+        case PlasmaComplexDouble: return plasma_zgetrf(n, n, A, n, ipiv);
+        }
+        break;
+    case PlasmaAutotunePotrf:
+        switch (dtyp) {
+        case PlasmaRealFloat:     return plasma_spotrf(PlasmaLower, n, A, n);
+        case PlasmaRealDouble:    return plasma_dpotrf(PlasmaLower, n, A, n);
+        case PlasmaComplexFloat:  return plasma_cpotrf(PlasmaLower, n, A, n);
+        case PlasmaComplexDouble: return plasma_zpotrf(PlasmaLower, n, A, n);
+        }
+        break;
+    }
+    return retval;
+}
+
+/******************************************************************************/
+// Times the routine with the current nb, ib, max_panel_threads and
+// small_size,
+// restoring A from A0 before each run. Returns the fastest time or a
+// negative value if the driver failed.
+static double plasma_autotune_time(int routine, plasma_enum_t dtyp, int n,
+                                   void *A, const void *A0, void *B, void *C,
+                                   int *ipiv)
+{
+    size_t size = (size_t)n*n*plasma_element_size(dtyp);
+    double best = -1.0;
+    for (int run = 0; run < PLASMA_AUTOTUNE_RUNS; run++) {
+        memcpy(A, A0, size);
+        double start = omp_get_wtime();
+        int retval = plasma_autotune_call(routine, dtyp, n, A, B, C, ipiv);
+        double time = omp_get_wtime()-start;
+        if (retval != PlasmaSuccess)
+            return -1.0;
+        if (best < 0.0 || time < best)
+            best = time;
+    }
+    return best;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_tuning
+    Benchmarks candidate tile sizes (PlasmaNb), inner block sizes (PlasmaIb)
+    and numbers of panel threads (PlasmaNumPanelThreads) for a routine, in
+    one precision, on an n-by-n problem with the current number of threads.
+    The parameters are tuned one after the other: nb first, then ib and
+    the number of panel threads with the best nb. Finally, for gemm, getrf
+    and potrf, the tiled algorithm with the winners is timed against the
+    LAPACK layout kernel of the small problem path, which sets the
+    PlasmaSmallSize threshold of the size bucket of n.
+
+    The winners are recorded in the tuning database of the context of the
+    calling thread for the size bucket of n and, if the database has a file
+    (see plasma_tuning_load() and the PLASMA_TUNING_DB environment variable),
+    saved to it. The drivers then use them when PlasmaTuning is enabled.
+    This function must be called outside of any parallel region.
+
+    @param[in] routine
+            "gemm", "gelqf", "geqrf", "getrf" or "potrf".
+
+    @param[in] dtyp
+            PlasmaRealFloat, PlasmaRealDouble, PlasmaComplexFloat or
+            PlasmaComplexDouble.
+
+    @param[in] n
+            The size of the benchmarked problem, n > 0.
+
+    @retval PlasmaSuccess successful exit
+*/
+int plasma_autotune(const char *routine, plasma_enum_t dtyp, int n)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (omp_in_parallel())
+        return PlasmaErrorEnvironment;
+
+    if (routine == NULL) {
+        plasma_error("NULL routine");
+        return PlasmaErrorNullParameter;
+    }
+    int num_routines = (int)(sizeof(plasma_autotune_routines_g)/
+                             sizeof(plasma_autotune_routines_g[0]));
+    int r;
+    for (r = 0; r < num_routines; r++)
+        if (strcmp(routine, plasma_autotune_routines_g[r].name) == 0)
+            break;
+    if (r == num_routines) {
+        plasma_error("routine not supported");
+        return PlasmaErrorNotSupported;
+    }
+    if (dtyp != PlasmaRealFloat && dtyp != PlasmaRealDouble &&
+        dtyp != PlasmaComplexFloat && dtyp != PlasmaComplexDouble) {
+        plasma_error("illegal value of dtyp");
+        return PlasmaErrorIllegalValue;
+    }
+    if (n <= 0) {
+        plasma_error("illegal value of n");
+        return PlasmaErrorIllegalValue;
+    }
+
+    // Allocate the problem.
+    size_t size = (size_t)n*n*plasma_element_size(dtyp);
+    void *A  = malloc(size);
+    void *A0 = malloc(size);
+    void *B  = malloc(size);
+    void *C  = malloc(size);
+    int *ipiv = (int*)malloc((size_t)n*sizeof(int));
+    if (A == NULL || A0 == NULL || B == NULL || C == NULL || ipiv == NULL) {
+        plasma_error("malloc() failed");
+        free(A);
+        free(A0);
+        free(B);
+        free(C);
+        free(ipiv);
+        return PlasmaErrorOutOfMemory;
+    }
+    plasma_autotune_fill(dtyp, A0, n);
+    memcpy(B, A0, size);
+
+    // Run the drivers with the candidates rather than tuned values.
+    int tuning = plasma->tuning;
+    int nb = plasma->nb;
+    int ib = plasma->ib;
+    int max_panel_threads = plasma->max_panel_threads;
+    int small_size = plasma->small_size;
+    plasma->tuning = PlasmaDisabled;
+    plasma->small_size = -1;
+
+    int retval = PlasmaSuccess;
+    double best = -1.0;
+    int best_nb = 0;
+    int num_nb = (int)(sizeof(plasma_autotune_nb_g)/sizeof(int));
+    for (int i = 0; i < num_nb; i++) {
+        // Tiles larger than the matrix only repeat the single tile case.
+        if (plasma_autotune_nb_g[i] > n && best_nb > 0)
+            break;
+        plasma->nb = plasma_autotune_nb_g[i];
+        double time = plasma_autotune_time(r, dtyp, n, A, A0, B, C, ipiv);
+        if (time < 0.0) {
+            retval = PlasmaErrorInternal;
+            break;
+        }
+        if (best < 0.0 || time < best) {
+            best = time;
+            best_nb = plasma->nb;
+        }
+    }
+    plasma->nb = best_nb;
+
+    int best_ib = 0;
+    if (retval == PlasmaSuccess && plasma_autotune_routines_g[r].ib) {
+        best = -1.0;
+        int num_ib = (int)(sizeof(plasma_autotune_ib_g)/sizeof(int));
+        for (int i = 0; i < num_ib && plasma_autotune_ib_g[i] <= best_nb;
+             i++) {
+            plasma->ib = plasma_autotune_ib_g[i];
+            double time = plasma_autotune_time(r, dtyp, n, A, A0, B, C, ipiv);
+            if (time < 0.0) {
+                retval = PlasmaErrorInternal;
+                break;
+            }
+            if (best < 0.0 || time < best) {
+                best = time;
+                best_ib = plasma->ib;
+            }
+        }
+        plasma->ib = best_ib;
+    }
+
+    int best_panel_threads = 0;
+    if (retval == PlasmaSuccess &&
+        plasma_autotune_routines_g[r].panel_threads) {
+        best = -1.0;
+        for (int p = 1; p <= omp_get_max_threads(); p *= 2) {
+            plasma->max_panel_threads = p;
+            double time = plasma_autotune_time(r, dtyp, n, A, A0, B, C, ipiv);
+            if (time < 0.0) {
+                retval = PlasmaErrorInternal;
+                break;
+            }
+            if (best < 0.0 || time < best) {
+                best = time;
+                best_panel_threads = p;
+            }
+        }
+        plasma->max_panel_threads = best_panel_threads;
+    }
+
+    // Time the small problem path against tiling with the winners.
+    // The threshold ends the size bucket of n if the small problem path
+    // is faster, the previous bucket if not, -1 if there is none.
+    int best_small = 0;
+    if (retval == PlasmaSuccess && plasma_autotune_routines_g[r].small) {
+        double tiled = plasma_autotune_time(r, dtyp, n, A, A0, B, C, ipiv);
+        plasma->small_size = n;
+        double direct = plasma_autotune_time(r, dtyp, n, A, A0, B, C, ipiv);
+        if (tiled < 0.0 || direct < 0.0) {
+            retval = PlasmaErrorInternal;
+        }
+        else {
+            int end = 1;
+            while (end <= n)
+                end <<= 1;
+            best_small = direct < tiled ? end-1 : end/2-1;
+            if (best_small == 0)
+                best_small = -1;
+        }
+    }
+
+    plasma->tuning = tuning;
+    plasma->nb = nb;
+    plasma->ib = ib;
+    plasma->max_panel_threads = max_panel_threads;
+    plasma->small_size = small_size;
+
+    free(A);
+    free(A0);
+    free(B);
+    free(C);
+    free(ipiv);
+
+    if (retval != PlasmaSuccess) {
+        plasma_error("benchmark failed");
+        return retval;
+    }
+
+    // Record and save the winners.
+    retval = plasma_tuning_record(plasma, routine, dtyp,
+                                  omp_get_max_threads(), n,
+                                  best_nb, best_ib, best_panel_threads,
+                                  best_small);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    return plasma_tuning_autosave(plasma);
+}
@@ -10,21 +10,95 @@
 
 #include "plasma_barrier.h"
 
+#include <limits.h>
+#include <sched.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/******************************************************************************/
+// Longest backoff, in pause instructions, and number of backoff rounds
+// before a blocking barrier goes to sleep.
+#define PLASMA_BARRIER_MAX_BACKOFF 1024
+#define PLASMA_BARRIER_SPIN_ROUNDS   16
+
+/******************************************************************************/
+// Tells the core the thread is spinning.
+static inline void plasma_barrier_pause()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __asm__ __volatile__ ("pause");
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__ ("yield");
+#endif
+}
+
+/******************************************************************************/
+// Sleeps while the generation is still passed.
+static void plasma_barrier_sleep(plasma_barrier_t *barrier, int passed)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, (int*)&barrier->passed, FUTEX_WAIT_PRIVATE, passed,
+            NULL, NULL, 0);
+#else
+    sched_yield();
+#endif
+}
+
 /******************************************************************************/
-void plasma_barrier_init(plasma_barrier_t *barrier)
+// Wakes up the threads sleeping in plasma_barrier_sleep().
+static void plasma_barrier_wake(plasma_barrier_t *barrier)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, (int*)&barrier->passed, FUTEX_WAKE_PRIVATE, INT_MAX,
+            NULL, NULL, 0);
+#endif
+}
+
+/******************************************************************************/
+void plasma_barrier_init(plasma_barrier_t *barrier, plasma_enum_t mode)
 {
     barrier->count = 0;
     barrier->passed = 0;
+    barrier->mode = mode;
 }
 
 /******************************************************************************/
 void plasma_barrier_wait(plasma_barrier_t *barrier, int size)
 {
-    int passed_old = barrier->passed;
+    int passed_old = __atomic_load_n(&barrier->passed, __ATOMIC_ACQUIRE);
+
+    if (__atomic_add_fetch(&barrier->count, 1, __ATOMIC_ACQ_REL) == size) {
+        // The last thread resets the count and releases the others.
+        __atomic_store_n(&barrier->count, 0, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&barrier->passed, 1, __ATOMIC_RELEASE);
+        if (barrier->mode == PlasmaBarrierBlocking)
+            plasma_barrier_wake(barrier);
+        return;
+    }
+
+    if (barrier->mode == PlasmaBarrierSpin) {
+        while (__atomic_load_n(&barrier->passed, __ATOMIC_ACQUIRE) ==
+               passed_old);
+        return;
+    }
 
-    __sync_fetch_and_add(&barrier->count, 1);
-    if (__sync_bool_compare_and_swap(&barrier->count, size, 0))
-        barrier->passed++;
-    else
-        while (barrier->passed == passed_old);
+    int backoff = 1;
+    int rounds = 0;
+    while (__atomic_load_n(&barrier->passed, __ATOMIC_ACQUIRE) ==
+           passed_old) {
+        if (barrier->mode == PlasmaBarrierBlocking &&
+            rounds >= PLASMA_BARRIER_SPIN_ROUNDS) {
+            plasma_barrier_sleep(barrier, passed_old);
+            continue;
+        }
+        for (int i = 0; i < backoff; i++)
+            plasma_barrier_pause();
+        if (backoff < PLASMA_BARRIER_MAX_BACKOFF)
+            backoff *= 2;
+        rounds++;
+    }
 }
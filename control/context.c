@@ -10,8 +10,12 @@
 
 #include "plasma_context.h"
 #include "plasma_internal.h"
+#include "plasma_stats.h"
+#include "plasma_trace.h"
+#include "plasma_tree.h"
 #include "plasma_tuning.h"
 
+#include <pthread.h>
 #include <stdlib.h>
 #include <omp.h>
 
@@ -19,25 +23,48 @@
 #include <magma.h>
 #endif
 
-static int plasma_initialized_g = 0;
-static plasma_context_t plasma_context_g;
+// Contexts attached to the threads.
+static plasma_context_map_t *plasma_context_map_g = NULL;
+static int plasma_num_contexts_g = 0;
+static int plasma_max_contexts_g = 0;
+static pthread_mutex_t plasma_context_map_lock_g = PTHREAD_MUTEX_INITIALIZER;
+
+// Context used by the threads without their own.
+static plasma_context_t *plasma_context_default_g = NULL;
+
+/******************************************************************************/
+// Returns the position of the calling thread in the context map or -1.
+// The map has to be locked.
+static int plasma_context_find()
+{
+    pthread_t self = pthread_self();
+    for (int i = 0; i < plasma_num_contexts_g; i++)
+        if (pthread_equal(plasma_context_map_g[i].thread_id, self))
+            return i;
+    return -1;
+}
 
 /***************************************************************************//**
     @ingroup plasma_init
-    Initializes PLASMA, allocating its context.
+    Initializes PLASMA, allocating the context of the calling thread.
+    Each application thread calling PLASMA concurrently has to initialize
+    PLASMA, so that it gets its own settings (PlasmaNb, PlasmaIb,
+    PlasmaNumThreads, etc.) and memory pool. Threads that did not
+    initialize PLASMA use the context of the first thread that did.
+    Task tracing is turned on if the PLASMA_TRACE or PLASMA_TRACE_SUMMARY
+    environment variables name files, see plasma_finalize().
     This function must be called outside of any parallel region.
 */
 int plasma_init()
 {
-    if (plasma_initialized_g)
-        return PlasmaErrorNotInitialized;
-
     if (omp_in_parallel())
         return PlasmaErrorNotInitialized;
 
-    plasma_initialized_g = 1;
+    int retval = plasma_context_attach();
+    if (retval != PlasmaSuccess)
+        return retval;
 
-    plasma_context_init(&plasma_context_g);
+    plasma_trace_init();
 
 #if defined(PLASMA_USE_MAGMA)
     magma_init();
@@ -48,36 +75,125 @@ int plasma_init()
 
 /***************************************************************************//**
     @ingroup plasma_init
-    Finalizes PLASMA, freeing its context.
+    Finalizes PLASMA, freeing the context of the calling thread.
+    Writes the Chrome trace and the trace summary of the tasks recorded
+    so far to the files named by PLASMA_TRACE and PLASMA_TRACE_SUMMARY,
+    if any, see plasma_trace_write() and plasma_trace_summary().
     This function must be called outside of any parallel region.
 */
 int plasma_finalize()
 {
-    if (! plasma_initialized_g)
-        return PlasmaErrorNotInitialized;
-
     if (omp_in_parallel())
         return PlasmaErrorEnvironment;
 
+    plasma_trace_finalize();
+
+    int retval = plasma_context_detach();
+    if (retval != PlasmaSuccess)
+        return retval;
+
 #if defined(PLASMA_USE_MAGMA)
     magma_finalize();
 #endif
 
-    plasma_context_finalize(&plasma_context_g);
+    return PlasmaSuccess;
+}
 
-    plasma_initialized_g = 0;
+/***************************************************************************//**
+    @ingroup plasma_init
+    Allocates a context initialized to default values and attaches it to
+    the calling thread. The first context attached becomes the default
+    context of the threads without their own.
+*/
+int plasma_context_attach()
+{
+    plasma_context_t *context =
+        (plasma_context_t*)malloc(sizeof(plasma_context_t));
+    if (context == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    plasma_context_init(context);
+
+    pthread_mutex_lock(&plasma_context_map_lock_g);
+    int retval = PlasmaSuccess;
+    if (plasma_context_find() >= 0) {
+        // already initialized
+        retval = PlasmaErrorNotInitialized;
+    }
+    else if (plasma_num_contexts_g == plasma_max_contexts_g) {
+        int max_contexts = plasma_max_contexts_g == 0 ?
+                           16 : 2*plasma_max_contexts_g;
+        plasma_context_map_t *map = (plasma_context_map_t*)realloc(
+            plasma_context_map_g, max_contexts*sizeof(plasma_context_map_t));
+        if (map == NULL) {
+            plasma_error("realloc() failed");
+            retval = PlasmaErrorOutOfMemory;
+        }
+        else {
+            plasma_context_map_g = map;
+            plasma_max_contexts_g = max_contexts;
+        }
+    }
+    if (retval == PlasmaSuccess) {
+        plasma_context_map_g[plasma_num_contexts_g].thread_id = pthread_self();
+        plasma_context_map_g[plasma_num_contexts_g].context = context;
+        plasma_num_contexts_g++;
+        if (plasma_context_default_g == NULL)
+            plasma_context_default_g = context;
+    }
+    pthread_mutex_unlock(&plasma_context_map_lock_g);
+
+    if (retval != PlasmaSuccess) {
+        plasma_context_finalize(context);
+        free(context);
+    }
+    return retval;
+}
 
+/***************************************************************************//**
+    @ingroup plasma_init
+    Detaches the context of the calling thread and frees it.
+    If it was the default context, the default context becomes the one
+    of another thread, if any.
+*/
+int plasma_context_detach()
+{
+    pthread_mutex_lock(&plasma_context_map_lock_g);
+    int i = plasma_context_find();
+    if (i < 0) {
+        pthread_mutex_unlock(&plasma_context_map_lock_g);
+        return PlasmaErrorNotInitialized;
+    }
+    plasma_context_t *context = plasma_context_map_g[i].context;
+    plasma_num_contexts_g--;
+    plasma_context_map_g[i] = plasma_context_map_g[plasma_num_contexts_g];
+    if (plasma_context_default_g == context) {
+        plasma_context_default_g = plasma_num_contexts_g > 0 ?
+                                   plasma_context_map_g[0].context : NULL;
+    }
+    if (plasma_num_contexts_g == 0) {
+        free(plasma_context_map_g);
+        plasma_context_map_g = NULL;
+        plasma_max_contexts_g = 0;
+    }
+    pthread_mutex_unlock(&plasma_context_map_lock_g);
+
+    plasma_context_finalize(context);
+    free(context);
     return PlasmaSuccess;
 }
 
 /***************************************************************************//**
     @ingroup plasma_init
-    Sets one of PLASMA's internal state variables.
+    Sets one of PLASMA's internal state variables,
+    in the context of the calling thread.
     This function must be called outside of any parallel region.
 */
 int plasma_set(plasma_enum_t param, int value)
 {
-    if (! plasma_initialized_g)
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL)
         return PlasmaErrorNotInitialized;
 
     if (omp_in_parallel())
@@ -89,35 +205,178 @@ int plasma_set(plasma_enum_t param, int value)
             plasma_error("invalid tuning flag");
             return PlasmaErrorIllegalValue;
         }
-        plasma_context_g.tuning = value;
+        plasma->tuning = value;
         break;
     case PlasmaNb:
         if (value <= 0) {
             plasma_error("invalid tile size");
             return PlasmaErrorIllegalValue;
         }
-        plasma_context_g.nb = value;
+        plasma->nb = value;
         break;
     case PlasmaIb:
         if (value <= 0) {
             plasma_error("invalid inner block size");
             return PlasmaErrorIllegalValue;
         }
-        plasma_context_g.ib = value;
+        plasma->ib = value;
+        break;
+    case PlasmaNumThreads:
+        // Applies to the parallel regions started by the calling thread.
+        if (value <= 0) {
+            plasma_error("invalid number of threads");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->max_threads = value;
+        omp_set_num_threads(value);
+        break;
+    case PlasmaInplaceOutplace:
+        if (value != PlasmaInplace && value != PlasmaOutplace) {
+            plasma_error("invalid layout translation mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->inplace_outplace = value;
         break;
     case PlasmaNumPanelThreads:
         if (value <= 0) {
             plasma_error("invalid number of panel threads");
             return PlasmaErrorIllegalValue;
         }
-        plasma_context_g.max_panel_threads = value;
+        plasma->max_panel_threads = value;
         break;
     case PlasmaHouseholderMode:
         if (value != PlasmaFlatHouseholder && value != PlasmaTreeHouseholder) {
             plasma_error("invalid Householder mode");
             return PlasmaErrorIllegalValue;
         }
-        plasma_context_g.householder_mode = value;
+        plasma->householder_mode = value;
+        break;
+    case PlasmaMemoryPool:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid memory pool flag");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->pool.enabled = value;
+        if (value == PlasmaDisabled)
+            plasma_pool_release(&plasma->pool);
+        break;
+    case PlasmaMemoryPoolCap:
+        if (value < 0) {
+            plasma_error("invalid memory pool cap");
+            return PlasmaErrorIllegalValue;
+        }
+        // in MiB
+        plasma_pool_set_cap(&plasma->pool, (size_t)value << 20);
+        break;
+    case PlasmaNumaPolicy:
+        if (value != PlasmaNumaDefault &&
+            value != PlasmaNumaInterleave &&
+            value != PlasmaNumaTileCyclic) {
+            plasma_error("invalid NUMA placement policy");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->numa_policy = value;
+        break;
+    case PlasmaAlignment:
+        // in bytes, a power of two
+        if (value < (int)sizeof(void*) || (value & (value-1)) != 0 ||
+            (size_t)value > PLASMA_POOL_HUGE_PAGE) {
+            plasma_error("invalid alignment");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma_pool_set_alignment(&plasma->pool, (size_t)value);
+        break;
+    case PlasmaHugePages:
+        if (value != PlasmaHugePagesNone &&
+            value != PlasmaHugePagesTransparent &&
+            value != PlasmaHugePagesExplicit) {
+            plasma_error("invalid huge pages policy");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma_pool_set_huge_pages(&plasma->pool, value);
+        break;
+    case PlasmaTilePadding:
+        // in bytes
+        if (value < 0) {
+            plasma_error("invalid tile padding");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->tile_padding = value;
+        break;
+    case PlasmaBarrierMode:
+        if (value != PlasmaBarrierSpin &&
+            value != PlasmaBarrierBackoff &&
+            value != PlasmaBarrierBlocking) {
+            plasma_error("invalid barrier mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->barrier_mode = value;
+        break;
+    case PlasmaTaskReplay:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid task replay flag");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->task_replay = value;
+        if (value == PlasmaDisabled)
+            plasma_dag_free_all(&plasma->dags);
+        break;
+    case PlasmaScheduling:
+        if (value != PlasmaDynamicScheduling &&
+            value != PlasmaStaticScheduling) {
+            plasma_error("invalid scheduling");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->scheduling = value;
+        break;
+    case PlasmaLookahead:
+        if (value < 0) {
+            plasma_error("invalid lookahead");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->lookahead = value;
+        break;
+    case PlasmaSmallSize:
+        if (value < -1) {
+            plasma_error("invalid small problem size");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->small_size = value;
+        break;
+    case PlasmaSmallNumThreads:
+        if (value <= 0) {
+            plasma_error("invalid number of small problem threads");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->small_threads = value;
+        break;
+    case PlasmaTrace:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid trace flag");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma_trace_enable(value);
+        break;
+    case PlasmaStats:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid stats flag");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma_stats_enable(value);
+        break;
+    case PlasmaHouseholderTree:
+        if (value < PlasmaTreeFlatTs || value > PlasmaTreeBlockGreedy) {
+            plasma_error("invalid Householder tree");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->householder_tree = value;
+        break;
+    case PlasmaDryRun:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid dry run flag");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->dry_run = value;
         break;
     default:
         plasma_error("unknown parameter");
@@ -128,28 +387,84 @@ int plasma_set(plasma_enum_t param, int value)
 
 /***************************************************************************//**
     @ingroup plasma_init
-    Gets one of PLASMA's internal state variables.
+    Gets one of PLASMA's internal state variables,
+    from the context of the calling thread.
 */
 int plasma_get(plasma_enum_t param, int *value)
 {
-    if (! plasma_initialized_g)
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL)
         return PlasmaErrorNotInitialized;
 
     switch (param) {
     case PlasmaTuning:
-        *value = plasma_context_g.tuning;
+        *value = plasma->tuning;
         return PlasmaSuccess;
     case PlasmaNb:
-        *value = plasma_context_g.nb;
+        *value = plasma->nb;
         return PlasmaSuccess;
     case PlasmaIb:
-        *value = plasma_context_g.ib;
+        *value = plasma->ib;
+        return PlasmaSuccess;
+    case PlasmaNumThreads:
+        *value = plasma->max_threads;
+        return PlasmaSuccess;
+    case PlasmaInplaceOutplace:
+        *value = plasma->inplace_outplace;
         return PlasmaSuccess;
     case PlasmaNumPanelThreads:
-        *value = plasma_context_g.max_panel_threads;
+        *value = plasma->max_panel_threads;
         return PlasmaSuccess;
     case PlasmaHouseholderMode:
-        *value = plasma_context_g.householder_mode;
+        *value = plasma->householder_mode;
+        return PlasmaSuccess;
+    case PlasmaMemoryPool:
+        *value = plasma->pool.enabled;
+        return PlasmaSuccess;
+    case PlasmaMemoryPoolCap:
+        *value = (int)(plasma->pool.cap >> 20);
+        return PlasmaSuccess;
+    case PlasmaNumaPolicy:
+        *value = plasma->numa_policy;
+        return PlasmaSuccess;
+    case PlasmaAlignment:
+        *value = (int)plasma->pool.alignment;
+        return PlasmaSuccess;
+    case PlasmaHugePages:
+        *value = plasma->pool.huge_pages;
+        return PlasmaSuccess;
+    case PlasmaTilePadding:
+        *value = plasma->tile_padding;
+        return PlasmaSuccess;
+    case PlasmaBarrierMode:
+        *value = plasma->barrier_mode;
+        return PlasmaSuccess;
+    case PlasmaTaskReplay:
+        *value = plasma->task_replay;
+        return PlasmaSuccess;
+    case PlasmaScheduling:
+        *value = plasma->scheduling;
+        return PlasmaSuccess;
+    case PlasmaLookahead:
+        *value = plasma->lookahead;
+        return PlasmaSuccess;
+    case PlasmaSmallSize:
+        *value = plasma->small_size;
+        return PlasmaSuccess;
+    case PlasmaSmallNumThreads:
+        *value = plasma->small_threads;
+        return PlasmaSuccess;
+    case PlasmaTrace:
+        *value = plasma_trace_enabled_g;
+        return PlasmaSuccess;
+    case PlasmaStats:
+        *value = plasma_stats_enabled_g;
+        return PlasmaSuccess;
+    case PlasmaHouseholderTree:
+        *value = plasma->householder_tree;
+        return PlasmaSuccess;
+    case PlasmaDryRun:
+        *value = plasma->dry_run;
         return PlasmaSuccess;
     default:
         plasma_error("Unknown parameter");
@@ -174,7 +489,22 @@ void plasma_context_init(plasma_context_t *context)
     context->inplace_outplace = PlasmaOutplace;
     context->max_threads = omp_get_max_threads();
     context->max_panel_threads = 1;
+    context->barrier_mode = PlasmaBarrierBlocking;
     context->householder_mode = PlasmaFlatHouseholder;
+    context->householder_tree = PlasmaTreeBlockGreedy;
+    plasma_pool_init(&context->pool);
+    context->numa_policy = PlasmaNumaDefault;
+    context->tile_padding = 0;
+    plasma_scratch_init(&context->scratch);
+    context->executor = NULL;
+    context->task_replay = PlasmaDisabled;
+    context->dags = NULL;
+    context->scheduling = PlasmaDynamicScheduling;
+    context->lookahead = 1;
+    context->small_size = 0;
+    context->small_threads = 1;
+    context->dry_run = PlasmaDisabled;
+    context->ss_progress = NULL;
 
     plasma_tuning_init(context);
 }
@@ -185,18 +515,26 @@ void plasma_context_init(plasma_context_t *context)
 */
 void plasma_context_finalize(plasma_context_t *context)
 {
+    // Complete the asynchronous calls still queued.
+    plasma_executor_finalize(context->executor);
+    context->executor = NULL;
     plasma_tuning_finalize(context);
+    plasma_dag_free_all(&context->dags);
+    plasma_scratch_free(&context->scratch, &context->pool);
+    plasma_pool_finalize(&context->pool);
 }
 
 /***************************************************************************//**
     @ingroup plasma_init
-    Returns PLASMA's default execution context or NULL if PLASMA was not
-    initialized.
+    Returns the execution context of the calling thread, the default context
+    if the thread has none, or NULL if PLASMA was not initialized.
 */
 plasma_context_t *plasma_context_self()
 {
-    if (plasma_initialized_g)
-        return &plasma_context_g;
-    else
-        return NULL;
+    pthread_mutex_lock(&plasma_context_map_lock_g);
+    int i = plasma_context_find();
+    plasma_context_t *context =
+        i >= 0 ? plasma_context_map_g[i].context : plasma_context_default_g;
+    pthread_mutex_unlock(&plasma_context_map_lock_g);
+    return context;
 }
@@ -0,0 +1,515 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_dag.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+/******************************************************************************/
+// Graphs recorded by dry runs, in the order of the calls.
+static plasma_dag_t *plasma_dag_dryruns_g = NULL;
+
+/******************************************************************************/
+// Grows an array of ints to hold at least size elements.
+static int plasma_dag_grow(int **array, int *max, int size)
+{
+    if (size <= *max)
+        return PlasmaSuccess;
+
+    int max_new = *max == 0 ? 256 : *max;
+    while (max_new < size)
+        max_new *= 2;
+    int *array_new = (int*)realloc(*array, (size_t)max_new*sizeof(int));
+    if (array_new == NULL) {
+        plasma_error("realloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    *array = array_new;
+    *max = max_new;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Frees the bookkeeping used only while recording.
+static void plasma_dag_free_recording(plasma_dag_t *dag)
+{
+    free(dag->edges);
+    free(dag->last_writer);
+    free(dag->readers);
+    free(dag->next_reader);
+    free(dag->reader_task);
+    dag->edges = NULL;
+    dag->last_writer = NULL;
+    dag->readers = NULL;
+    dag->next_reader = NULL;
+    dag->reader_task = NULL;
+}
+
+/******************************************************************************/
+// Returns the graph recorded in the context of the calling thread for
+// routine, variant, mt and nt, or NULL.
+plasma_dag_t *plasma_dag_find(int routine, int variant, int mt, int nt)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL)
+        return NULL;
+
+    for (plasma_dag_t *dag = plasma->dags; dag != NULL; dag = dag->next) {
+        if (dag->routine == routine && dag->variant == variant &&
+            dag->mt == mt && dag->nt == nt)
+            return dag;
+    }
+    return NULL;
+}
+
+/******************************************************************************/
+// Starts recording a graph and adds it to the context of the calling thread
+// once plasma_dag_finish() succeeds. Returns NULL on failure.
+plasma_dag_t *plasma_dag_create(int routine, int variant, int mt, int nt)
+{
+    plasma_dag_t *dag = (plasma_dag_t*)calloc(1, sizeof(plasma_dag_t));
+    if (dag == NULL) {
+        plasma_error("malloc() failed");
+        return NULL;
+    }
+    dag->routine = routine;
+    dag->variant = variant;
+    dag->mt = mt;
+    dag->nt = nt;
+
+    size_t num_tiles = (size_t)mt*nt;
+    dag->last_writer = (int*)malloc(num_tiles*sizeof(int));
+    dag->readers = (int*)malloc(num_tiles*sizeof(int));
+    if (dag->last_writer == NULL || dag->readers == NULL) {
+        plasma_error("malloc() failed");
+        plasma_dag_destroy(dag);
+        return NULL;
+    }
+    for (size_t i = 0; i < num_tiles; i++) {
+        dag->last_writer[i] = -1;
+        dag->readers[i] = -1;
+    }
+    return dag;
+}
+
+/******************************************************************************/
+// Adds a task. Its tile accesses follow with plasma_dag_access().
+int plasma_dag_task(plasma_dag_t *dag, int kernel, int k, int m, int n)
+{
+    if (dag->status != PlasmaSuccess)
+        return dag->status;
+
+    if (dag->num_tasks == dag->max_tasks) {
+        int max_tasks = dag->max_tasks == 0 ? 256 : 2*dag->max_tasks;
+        plasma_dag_task_t *tasks = (plasma_dag_task_t*)realloc(
+            dag->tasks, (size_t)max_tasks*sizeof(plasma_dag_task_t));
+        if (tasks == NULL) {
+            plasma_error("realloc() failed");
+            dag->status = PlasmaErrorOutOfMemory;
+            return dag->status;
+        }
+        dag->tasks = tasks;
+        dag->max_tasks = max_tasks;
+    }
+    plasma_dag_task_t *task = &dag->tasks[dag->num_tasks++];
+    task->kernel = kernel;
+    task->k = k;
+    task->m = m;
+    task->n = n;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+static int plasma_dag_edge(plasma_dag_t *dag, int pred, int succ)
+{
+    int retval = plasma_dag_grow(&dag->edges, &dag->max_edges,
+                                 2*(dag->num_edges+1));
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    dag->edges[2*dag->num_edges] = pred;
+    dag->edges[2*dag->num_edges+1] = succ;
+    dag->num_edges++;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Records an access of the last task added to tile (m, n), with the same
+// semantics as the in and inout dependences of OpenMP tasks.
+// Errors stick to the graph, so that recording can go on unchecked.
+int plasma_dag_access(plasma_dag_t *dag, int m, int n, int mode)
+{
+    if (dag->status != PlasmaSuccess)
+        return dag->status;
+
+    int task = dag->num_tasks-1;
+    int tile = m + dag->mt*n;
+    int writer = dag->last_writer[tile];
+    int retval = PlasmaSuccess;
+
+    if (mode == PlasmaDagIn) {
+        if (writer >= 0 && writer != task)
+            retval = plasma_dag_edge(dag, writer, task);
+        if (retval != PlasmaSuccess) {
+            dag->status = retval;
+            return retval;
+        }
+
+        // Add to the readers of the tile.
+        int max_readers = dag->max_readers;
+        retval = plasma_dag_grow(&dag->reader_task, &max_readers,
+                                 dag->num_readers+1);
+        if (retval == PlasmaSuccess)
+            retval = plasma_dag_grow(&dag->next_reader, &dag->max_readers,
+                                     dag->num_readers+1);
+        if (retval != PlasmaSuccess) {
+            dag->status = retval;
+            return retval;
+        }
+        dag->reader_task[dag->num_readers] = task;
+        dag->next_reader[dag->num_readers] = dag->readers[tile];
+        dag->readers[tile] = dag->num_readers++;
+    }
+    else {
+        // Writers wait for the readers since the last write,
+        // which waited for that write.
+        if (dag->readers[tile] >= 0) {
+            for (int r = dag->readers[tile]; r >= 0 && retval == PlasmaSuccess;
+                 r = dag->next_reader[r]) {
+                if (dag->reader_task[r] != task)
+                    retval = plasma_dag_edge(dag, dag->reader_task[r], task);
+            }
+        }
+        else if (writer >= 0 && writer != task) {
+            retval = plasma_dag_edge(dag, writer, task);
+        }
+        dag->last_writer[tile] = task;
+        dag->readers[tile] = -1;
+    }
+    dag->status = retval;
+    return retval;
+}
+
+/******************************************************************************/
+// Converts the recorded edges to successor lists and predecessor counts.
+int plasma_dag_build(plasma_dag_t *dag)
+{
+    if (dag->status != PlasmaSuccess)
+        return dag->status;
+
+    dag->num_deps = (int*)calloc(dag->num_tasks, sizeof(int));
+    dag->succ_ptr = (int*)calloc(dag->num_tasks+1, sizeof(int));
+    dag->succ = (int*)malloc(((size_t)dag->num_edges+1)*sizeof(int));
+    if (dag->num_deps == NULL || dag->succ_ptr == NULL || dag->succ == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    for (int e = 0; e < dag->num_edges; e++) {
+        dag->succ_ptr[dag->edges[2*e]+1]++;
+        dag->num_deps[dag->edges[2*e+1]]++;
+    }
+    for (int i = 0; i < dag->num_tasks; i++)
+        dag->succ_ptr[i+1] += dag->succ_ptr[i];
+
+    // Edges were recorded in task order, so the lists stay in task order.
+    int *fill = (int*)malloc(((size_t)dag->num_tasks+1)*sizeof(int));
+    if (fill == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    memcpy(fill, dag->succ_ptr, dag->num_tasks*sizeof(int));
+    for (int e = 0; e < dag->num_edges; e++)
+        dag->succ[fill[dag->edges[2*e]]++] = dag->edges[2*e+1];
+    free(fill);
+
+    plasma_dag_free_recording(dag);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Completes a recorded graph and adds it to the context of the calling
+// thread.
+int plasma_dag_finish(plasma_dag_t *dag)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL)
+        return PlasmaErrorNotInitialized;
+
+    int retval = plasma_dag_build(dag);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    dag->next = plasma->dags;
+    plasma->dags = dag;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Completes a graph recorded by a dry run of routine name, describes its
+// tasks, and keeps it for plasma_dag_write(). Takes over the graph, which
+// is destroyed on failure.
+int plasma_dag_dryrun(plasma_dag_t *dag, const char *name,
+                      int m, int n, int nb, int ib,
+                      void (*describe)(const plasma_dag_task_t *task,
+                                       void *arg, plasma_dag_info_t *info),
+                      void *arg)
+{
+    int retval = plasma_dag_build(dag);
+    if (retval == PlasmaSuccess) {
+        dag->info = (plasma_dag_info_t*)malloc(
+            ((size_t)dag->num_tasks+1)*sizeof(plasma_dag_info_t));
+        if (dag->info == NULL) {
+            plasma_error("malloc() failed");
+            retval = PlasmaErrorOutOfMemory;
+        }
+    }
+    if (retval != PlasmaSuccess) {
+        plasma_dag_destroy(dag);
+        return retval;
+    }
+    dag->name = name;
+    dag->m = m;
+    dag->n = n;
+    dag->nb = nb;
+    dag->ib = ib;
+    for (int i = 0; i < dag->num_tasks; i++)
+        describe(&dag->tasks[i], arg, &dag->info[i]);
+
+    // Graphs are kept in the order of the calls.
+    #pragma omp critical(plasma_dag)
+    {
+        plasma_dag_t **last = &plasma_dag_dryruns_g;
+        while (*last != NULL)
+            last = &(*last)->next;
+        dag->next = NULL;
+        *last = dag;
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_dag
+    Writes the task graphs recorded by the drivers called while
+    plasma_set(PlasmaDryRun, PlasmaEnabled) was in effect, as JSON.
+    Each task has its kernel, step and tile indices, flops, priority,
+    number of threads, and the tasks it depends on, which come first.
+    The graphs are kept until plasma_dag_clear().
+    tools/plasma_dag.py estimates their critical path, parallelism and
+    speedups.
+*/
+int plasma_dag_write(const char *filename)
+{
+    if (filename == NULL) {
+        plasma_error("NULL filename");
+        return PlasmaErrorNullParameter;
+    }
+    FILE *file = fopen(filename, "w");
+    if (file == NULL) {
+        plasma_error("cannot write task graphs");
+        return PlasmaErrorIllegalValue;
+    }
+
+    int retval = PlasmaSuccess;
+    #pragma omp critical(plasma_dag)
+    {
+        fprintf(file, "{\n  \"graphs\": [");
+        for (plasma_dag_t *dag = plasma_dag_dryruns_g;
+             dag != NULL && retval == PlasmaSuccess; dag = dag->next) {
+            // Invert the successor lists.
+            int *pred_ptr = (int*)calloc((size_t)dag->num_tasks+1,
+                                         sizeof(int));
+            int *pred = (int*)malloc(
+                ((size_t)dag->succ_ptr[dag->num_tasks]+1)*sizeof(int));
+            if (pred_ptr == NULL || pred == NULL) {
+                plasma_error("malloc() failed");
+                retval = PlasmaErrorOutOfMemory;
+            }
+            else {
+                for (int i = 0; i < dag->num_tasks; i++)
+                    pred_ptr[i+1] = pred_ptr[i]+dag->num_deps[i];
+                for (int i = 0; i < dag->num_tasks; i++)
+                    for (int s = dag->succ_ptr[i]; s < dag->succ_ptr[i+1]; s++)
+                        pred[pred_ptr[dag->succ[s]]++] = i;
+                // pred_ptr now holds the ends of the lists.
+
+                fprintf(file, "%s\n    {\"routine\": \"%s\", "
+                              "\"m\": %d, \"n\": %d, "
+                              "\"nb\": %d, \"ib\": %d,\n"
+                              "     \"tasks\": [",
+                        dag == plasma_dag_dryruns_g ? "" : ",",
+                        dag->name, dag->m, dag->n, dag->nb, dag->ib);
+                for (int i = 0; i < dag->num_tasks; i++) {
+                    plasma_dag_task_t *task = &dag->tasks[i];
+                    plasma_dag_info_t *info = &dag->info[i];
+                    fprintf(file, "%s\n      {\"id\": %d, \"kernel\": \"%s\", "
+                                  "\"k\": %d, \"m\": %d, \"n\": %d, "
+                                  "\"flops\": %.6e, \"priority\": %d, "
+                                  "\"threads\": %d, \"deps\": [",
+                            i == 0 ? "" : ",", i, info->name,
+                            task->k, task->m, task->n, info->flops,
+                            info->priority, info->threads);
+                    int first = i == 0 ? 0 : pred_ptr[i-1];
+                    for (int p = first; p < pred_ptr[i]; p++)
+                        fprintf(file, "%s%d", p == first ? "" : ", ", pred[p]);
+                    fprintf(file, "]}");
+                }
+                fprintf(file, "\n    ]}");
+            }
+            free(pred_ptr);
+            free(pred);
+        }
+        fprintf(file, "\n  ]\n}\n");
+    }
+    fclose(file);
+    return retval;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_dag
+    Discards the task graphs recorded by dry runs.
+    This function must be called outside of any parallel region.
+*/
+void plasma_dag_clear()
+{
+    #pragma omp critical(plasma_dag)
+    {
+        while (plasma_dag_dryruns_g != NULL) {
+            plasma_dag_t *dag = plasma_dag_dryruns_g;
+            plasma_dag_dryruns_g = dag->next;
+            plasma_dag_destroy(dag);
+        }
+    }
+}
+
+/******************************************************************************/
+// State shared by the threads replaying a graph.
+typedef struct {
+    plasma_dag_t *dag;
+    void (*run)(const plasma_dag_task_t *task, void *arg);
+    void *arg;
+    int *num_deps;  // predecessors still running
+    int *queue;     // ready tasks in the order they became ready, or -1
+    int head;       // next slot of the queue to take
+    int tail;       // next slot of the queue to fill
+} plasma_dag_replay_t;
+
+/******************************************************************************/
+static void plasma_dag_push(plasma_dag_replay_t *state, int task)
+{
+    int slot = __atomic_fetch_add(&state->tail, 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&state->queue[slot], task, __ATOMIC_RELEASE);
+}
+
+/******************************************************************************/
+// Takes the slots of the queue in order, waiting for each to be filled,
+// until all tasks are taken. Every slot gets filled, since a task of the
+// graph becomes ready once all its predecessors ran.
+static void plasma_dag_work(plasma_dag_replay_t *state)
+{
+    plasma_dag_t *dag = state->dag;
+    for (;;) {
+        int slot = __atomic_fetch_add(&state->head, 1, __ATOMIC_RELAXED);
+        if (slot >= dag->num_tasks)
+            return;
+
+        int task;
+        int spins = 0;
+        while ((task = __atomic_load_n(&state->queue[slot],
+                                       __ATOMIC_ACQUIRE)) < 0) {
+            if (++spins > 64)
+                sched_yield();
+        }
+        state->run(&dag->tasks[task], state->arg);
+
+        for (int s = dag->succ_ptr[task]; s < dag->succ_ptr[task+1]; s++) {
+            int succ = dag->succ[s];
+            if (__atomic_sub_fetch(&state->num_deps[succ], 1,
+                                   __ATOMIC_ACQ_REL) == 0)
+                plasma_dag_push(state, succ);
+        }
+    }
+}
+
+/******************************************************************************/
+// Runs the tasks of the graph with the threads of the current team, in
+// place of creating OpenMP tasks. Called by the master thread of the
+// parallel region of a driver. Tasks created before are completed first.
+void plasma_dag_replay(plasma_dag_t *dag,
+                       void (*run)(const plasma_dag_task_t *task, void *arg),
+                       void *arg)
+{
+    #pragma omp taskwait
+
+    plasma_dag_replay_t state;
+    state.dag = dag;
+    state.run = run;
+    state.arg = arg;
+    state.num_deps = (int*)malloc((size_t)dag->num_tasks*sizeof(int));
+    state.queue = (int*)malloc((size_t)dag->num_tasks*sizeof(int));
+    state.head = 0;
+    state.tail = 0;
+    if (state.num_deps == NULL || state.queue == NULL) {
+        // Tasks were recorded in a valid order.
+        for (int i = 0; i < dag->num_tasks; i++)
+            run(&dag->tasks[i], arg);
+        free(state.num_deps);
+        free(state.queue);
+        return;
+    }
+    memcpy(state.num_deps, dag->num_deps, dag->num_tasks*sizeof(int));
+    for (int i = 0; i < dag->num_tasks; i++)
+        state.queue[i] = -1;
+    for (int i = 0; i < dag->num_tasks; i++)
+        if (dag->num_deps[i] == 0)
+            plasma_dag_push(&state, i);
+
+    int nthread = omp_get_num_threads();
+    for (int i = 1; i < nthread; i++) {
+        #pragma omp task shared(state)
+        plasma_dag_work(&state);
+    }
+    plasma_dag_work(&state);
+    #pragma omp taskwait
+
+    free(state.num_deps);
+    free(state.queue);
+}
+
+/******************************************************************************/
+void plasma_dag_destroy(plasma_dag_t *dag)
+{
+    if (dag == NULL)
+        return;
+
+    plasma_dag_free_recording(dag);
+    free(dag->tasks);
+    free(dag->num_deps);
+    free(dag->succ_ptr);
+    free(dag->succ);
+    free(dag->info);
+    free(dag);
+}
+
+/******************************************************************************/
+// Frees the graphs recorded in a context.
+void plasma_dag_free_all(plasma_dag_t **dags)
+{
+    while (*dags != NULL) {
+        plasma_dag_t *dag = *dags;
+        *dags = dag->next;
+        plasma_dag_destroy(dag);
+    }
+}
@@ -12,6 +12,104 @@
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 
+#include <omp.h>
+#include <stdint.h>
+#include <unistd.h>
+
+/******************************************************************************/
+// Touches the pages of [ptr, ptr+size) so that the first touch policy of
+// the operating system places them on the NUMA node of the calling thread.
+static void plasma_touch_pages(void *ptr, size_t size, size_t page)
+{
+    char *p = (char*)ptr;
+    char *end = p + size;
+    while (p < end) {
+        *(volatile char*)p = 0;
+        // beginning of the next page
+        p = (char*)(((uintptr_t)p & ~(uintptr_t)(page-1)) + page);
+    }
+}
+
+/******************************************************************************/
+// Returns the thread owning tile (m, n) in the PlasmaNumaTileCyclic policy.
+// Tiles are dealt to the threads cyclically in column-major order.
+static int plasma_tile_owner(plasma_desc_t *A, int m, int n, int nthread)
+{
+    return (int)(((size_t)n*A->gmt + m) % nthread);
+}
+
+/***************************************************************************//**
+    Places the pages of a newly allocated descriptor according to the NUMA
+    placement policy of the context by touching them from the threads
+    that should own them. Has no effect on pages already touched, e.g.,
+    buffers recycled by the memory pool keep their placement.
+*/
+static void plasma_desc_place(plasma_context_t *plasma, plasma_desc_t *A,
+                              size_t size)
+{
+    if (plasma->numa_policy == PlasmaNumaDefault || omp_in_parallel())
+        return;
+
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t eltsize = plasma_element_size(A->precision);
+
+    // full matrix view
+    plasma_desc_t V = *A;
+    V.i = 0;
+    V.j = 0;
+
+    #pragma omp parallel
+    {
+        int tid = omp_get_thread_num();
+        int nthread = omp_get_num_threads();
+
+        if (plasma->numa_policy == PlasmaNumaInterleave) {
+            // Deal the pages to the threads cyclically.
+            uintptr_t begin = (uintptr_t)V.matrix;
+            uintptr_t first = begin & ~(uintptr_t)(page-1);
+            size_t npage = (begin + size - first + page-1)/page;
+            for (size_t k = tid; k < npage; k += nthread) {
+                uintptr_t p = first + k*page;
+                plasma_touch_pages((void*)(p < begin ? begin : p), 1, page);
+            }
+        }
+        else {
+            for (int n = 0; n < V.gnt; n++) {
+                int nvn = n < V.gn/V.nb ? V.nb : V.gn%V.nb;
+                for (int m = 0; m < V.gmt; m++) {
+                    if ((V.type == PlasmaLower && m < n) ||
+                        (V.type == PlasmaUpper && m > n))
+                        continue;
+                    if (plasma_tile_owner(&V, m, n, nthread) != tid)
+                        continue;
+                    int mvm = m < V.gm/V.mb ? V.mb : V.gm%V.mb;
+                    void *tile = V.type == PlasmaGeneral ||
+                                 V.type == PlasmaGeneralBand ?
+                                 plasma_tile_addr_general(V, m, n) :
+                                 plasma_tile_addr_triangle(V, m, n);
+                    plasma_touch_pages(tile, (size_t)mvm*nvn*eltsize, page);
+                }
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Follows each tile of the general matrix A with pad elements
+// and recomputes the offsets of A21, A12 and A22 accordingly.
+static void plasma_desc_general_pad(plasma_desc_t *A, int pad)
+{
+    size_t lm1 = A->gm/A->mb;
+    size_t ln1 = A->gn/A->nb;
+    size_t m2 = A->gm%A->mb;
+    size_t n2 = A->gn%A->nb;
+
+    A->pad = pad;
+    A->A21 = lm1*ln1*((size_t)A->mb*A->nb + pad);
+    A->A12 = A->A21 + (m2 == 0 ? 0 : ln1*(A->nb*m2 + pad));
+    A->A22 = A->A12 + (n2 == 0 ? 0 : lm1*(A->mb*n2 + pad));
+}
+
 /******************************************************************************/
 int plasma_desc_general_create(plasma_enum_t precision, int mb, int nb,
                                int lm, int ln, int i, int j, int m, int n,
@@ -35,14 +133,21 @@ int plasma_desc_general_create(plasma_enum_t precision, int mb, int nb,
         plasma_error("plasma_desc_check() failed");
         return PlasmaErrorIllegalValue;
     }
+    // Pad the tiles.
+    size_t eltsize = plasma_element_size(A->precision);
+    int pad = (int)((plasma->tile_padding + eltsize-1)/eltsize);
+    if (pad > 0)
+        plasma_desc_general_pad(A, pad);
+
     // Allocate the matrix.
-    size_t size = (size_t)A->gm*A->gn*
-                  plasma_element_size(A->precision);
-    A->matrix = malloc(size);
+    size_t size = plasma_desc_size(*A)*eltsize;
+    A->matrix = plasma_pool_alloc(&plasma->pool, size);
     if (A->matrix == NULL) {
-        plasma_error("malloc() failed");
+        plasma_error("plasma_pool_alloc() failed");
         return PlasmaErrorOutOfMemory;
     }
+    A->pooled = 1;
+    plasma_desc_place(plasma, A, size);
     return PlasmaSuccess;
 }
 
@@ -73,11 +178,13 @@ int plasma_desc_general_band_create(plasma_enum_t precision, plasma_enum_t uplo,
     // Allocate the matrix.
     size_t size = (size_t)A->gm*A->gn*
                   plasma_element_size(A->precision);
-    A->matrix = malloc(size);
+    A->matrix = plasma_pool_alloc(&plasma->pool, size);
     if (A->matrix == NULL) {
-        plasma_error("malloc() failed");
+        plasma_error("plasma_pool_alloc() failed");
         return PlasmaErrorOutOfMemory;
     }
+    A->pooled = 1;
+    plasma_desc_place(plasma, A, size);
     return PlasmaSuccess;
 }
 
@@ -110,11 +217,52 @@ int plasma_desc_triangular_create(plasma_enum_t precision, plasma_enum_t uplo, i
     int mnt = (ln1*(1+lm1))/2;
     size_t size = (size_t)(mnt*mb*nb + (lm * (ln%nb)))*
                   plasma_element_size(A->precision);
-    A->matrix = malloc(size);
+    A->matrix = plasma_pool_alloc(&plasma->pool, size);
     if (A->matrix == NULL) {
-        plasma_error("malloc() failed");
+        plasma_error("plasma_pool_alloc() failed");
         return PlasmaErrorOutOfMemory;
     }
+    A->pooled = 1;
+    plasma_desc_place(plasma, A, size);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    Creates a descriptor for the m-by-n matrix pA in column-major layout.
+    If in-place layout translation is enabled (PlasmaInplaceOutplace) and
+    pA has no padding (lda == m), the descriptor aliases pA, which is then
+    translated by permuting it in place. Otherwise, or if pA is NULL,
+    the tile layout copy is allocated as by plasma_desc_general_create().
+*/
+int plasma_desc_general_inplace_create(plasma_enum_t precision,
+                                       void *pA, int lda,
+                                       int mb, int nb, int m, int n,
+                                       plasma_desc_t *A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (plasma->inplace_outplace != PlasmaInplace ||
+        pA == NULL || lda != m || m == 0 || n == 0) {
+        return plasma_desc_general_create(precision, mb, nb,
+                                          m, n, 0, 0, m, n, A);
+    }
+    // Initialize the descriptor.
+    int retval = plasma_desc_general_init(precision, pA, mb, nb,
+                                          m, n, 0, 0, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_init() failed");
+        return retval;
+    }
+    // Check the descriptor.
+    retval = plasma_desc_check(*A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_check() failed");
+        return PlasmaErrorIllegalValue;
+    }
+    A->inplace = 1;
     return PlasmaSuccess;
 }
 
@@ -126,7 +274,11 @@ int plasma_desc_destroy(plasma_desc_t *A)
         plasma_error("PLASMA not initialized");
         return PlasmaErrorNotInitialized;
     }
-    free(A->matrix);
+    // In-place descriptors do not own the matrix.
+    if (A->pooled)
+        plasma_pool_free(&plasma->pool, A->matrix);
+    else if (! A->inplace)
+        free(A->matrix);
     return PlasmaSuccess;
 }
 
@@ -141,6 +293,9 @@ int plasma_desc_general_init(plasma_enum_t precision, void *matrix,
 
     // pointer and offsets
     A->matrix = matrix;
+    A->inplace = 0;
+    A->pooled = 0;
+    A->pad = 0;
     A->A21 = (size_t)(lm - lm%mb) * (ln - ln%nb);
     A->A12 = (size_t)(     lm%mb) * (ln - ln%nb) + A->A21;
     A->A22 = (size_t)(lm - lm%mb) * (     ln%nb) + A->A12;
@@ -230,6 +385,9 @@ int plasma_desc_triangular_init(plasma_enum_t precision, plasma_enum_t uplo, voi
     int ln1 = ln/nb;
     int mnt = (ln1*(1+lm1))/2;
     A->matrix = matrix;
+    A->inplace = 0;
+    A->pooled = 0;
+    A->pad = 0;
     A->A21 = (size_t)(mb * nb) * mnt; // only for PlasmaLower
     A->A12 = (size_t)(mb * nb) * mnt; // only for PlasmaUpper
     A->A22 = (size_t)(lm - lm%mb) * (ln%nb) + A->A12;
@@ -0,0 +1,309 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_future.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+/******************************************************************************/
+// Runs the futures submitted through a context on a thread of its own.
+struct plasma_executor_s {
+    pthread_mutex_t mutex;  // protects the queue and shutdown
+    pthread_cond_t cond;    // signaled when a future is queued or on shutdown
+    plasma_future_t *head;  // next future to run
+    plasma_future_t *tail;  // last future submitted
+    int shutdown;           // set when the context is finalized
+    pthread_t thread;
+};
+
+// Serializes starting the executors of contexts shared by several threads.
+static pthread_mutex_t plasma_executor_lock_g = PTHREAD_MUTEX_INITIALIZER;
+
+// Settings of the context carried by a future to the executor.
+static const plasma_enum_t
+plasma_future_params_g[PLASMA_FUTURE_NUM_SETTINGS] = {
+    PlasmaTuning,
+    PlasmaNb,
+    PlasmaIb,
+    PlasmaInplaceOutplace,
+    PlasmaNumPanelThreads,
+    PlasmaHouseholderMode,
+    PlasmaMemoryPool,
+    PlasmaMemoryPoolCap,
+    PlasmaNumaPolicy,
+    PlasmaAlignment,
+    PlasmaHugePages,
+    PlasmaTilePadding,
+    PlasmaBarrierMode,
+    PlasmaNumThreads,
+    PlasmaTaskReplay,
+    PlasmaScheduling,
+    PlasmaLookahead,
+    PlasmaSmallSize,
+    PlasmaSmallNumThreads,
+    PlasmaHouseholderTree,
+    PlasmaDryRun
+};
+
+/******************************************************************************/
+// Applies the settings of the future to the context of the executor,
+// touching only the ones that differ, so that the pool keeps its buffers.
+static int plasma_executor_apply(plasma_future_t *future)
+{
+    for (int i = 0; i < PLASMA_FUTURE_NUM_SETTINGS; i++) {
+        int value;
+        int retval = plasma_get(plasma_future_params_g[i], &value);
+        if (retval == PlasmaSuccess && value != future->settings[i])
+            retval = plasma_set(plasma_future_params_g[i],
+                                future->settings[i]);
+        if (retval != PlasmaSuccess)
+            return retval;
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Thread of the executor. Runs the futures in submission order, in a
+// context of its own, until the executor is shut down and the queue empty.
+static void *plasma_executor_main(void *arg)
+{
+    struct plasma_executor_s *executor = (struct plasma_executor_s*)arg;
+    int attached = plasma_context_attach();
+
+    for (;;) {
+        pthread_mutex_lock(&executor->mutex);
+        while (executor->head == NULL && ! executor->shutdown)
+            pthread_cond_wait(&executor->cond, &executor->mutex);
+        plasma_future_t *future = executor->head;
+        if (future != NULL) {
+            executor->head = future->next;
+            if (executor->head == NULL)
+                executor->tail = NULL;
+        }
+        pthread_mutex_unlock(&executor->mutex);
+        if (future == NULL)
+            break;
+
+        int status = attached;
+        if (status == PlasmaSuccess)
+            status = plasma_executor_apply(future);
+        if (status == PlasmaSuccess)
+            status = future->run(future->args);
+        free(future->args);
+        future->args = NULL;
+
+        if (future->callback != NULL)
+            future->callback(status, future->data);
+
+        pthread_mutex_lock(&future->mutex);
+        future->status = status;
+        future->done = 1;
+        pthread_cond_broadcast(&future->cond);
+        pthread_mutex_unlock(&future->mutex);
+    }
+
+    if (attached == PlasmaSuccess)
+        plasma_context_detach();
+    return NULL;
+}
+
+/******************************************************************************/
+// Starts the executor of the context, if not started yet.
+static int plasma_executor_start(plasma_context_t *plasma)
+{
+    int retval = PlasmaSuccess;
+    pthread_mutex_lock(&plasma_executor_lock_g);
+    if (plasma->executor == NULL) {
+        struct plasma_executor_s *executor =
+            (struct plasma_executor_s*)malloc(sizeof(*executor));
+        if (executor == NULL) {
+            plasma_error("malloc() failed");
+            retval = PlasmaErrorOutOfMemory;
+        }
+        else {
+            pthread_mutex_init(&executor->mutex, NULL);
+            pthread_cond_init(&executor->cond, NULL);
+            executor->head = NULL;
+            executor->tail = NULL;
+            executor->shutdown = 0;
+            if (pthread_create(&executor->thread, NULL,
+                               plasma_executor_main, executor) != 0) {
+                plasma_error("pthread_create() failed");
+                pthread_cond_destroy(&executor->cond);
+                pthread_mutex_destroy(&executor->mutex);
+                free(executor);
+                retval = PlasmaErrorEnvironment;
+            }
+            else {
+                plasma->executor = executor;
+            }
+        }
+    }
+    pthread_mutex_unlock(&plasma_executor_lock_g);
+    return retval;
+}
+
+/******************************************************************************/
+// Runs the futures still queued and stops the executor.
+// Called when its context is finalized.
+void plasma_executor_finalize(struct plasma_executor_s *executor)
+{
+    if (executor == NULL)
+        return;
+
+    pthread_mutex_lock(&executor->mutex);
+    executor->shutdown = 1;
+    pthread_cond_signal(&executor->cond);
+    pthread_mutex_unlock(&executor->mutex);
+
+    pthread_join(executor->thread, NULL);
+    pthread_cond_destroy(&executor->cond);
+    pthread_mutex_destroy(&executor->mutex);
+    free(executor);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_future
+    Queues a driver call to the executor of the calling thread's context.
+    Used by the asynchronous drivers. The arguments are taken over and
+    freed with free() once run() returns.
+
+    @param[in] run
+            Calls the synchronous driver with args and returns its status.
+
+    @param[in] args
+            The arguments of run, allocated with malloc().
+
+    @param[in] callback
+            Called on completion, may be NULL.
+
+    @param[in] data
+            Passed to callback.
+
+    @param[out] future
+            On exit, the future of the call, to be destroyed with
+            plasma_future_destroy().
+
+    @retval PlasmaSuccess successful exit
+*/
+int plasma_future_submit(int (*run)(void *args), void *args,
+                         plasma_callback_t callback, void *data,
+                         plasma_future_t **future)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        free(args);
+        return PlasmaErrorNotInitialized;
+    }
+    if (future == NULL) {
+        plasma_error("NULL future");
+        free(args);
+        return PlasmaErrorNullParameter;
+    }
+    *future = NULL;
+
+    int retval = plasma_executor_start(plasma);
+    if (retval != PlasmaSuccess) {
+        free(args);
+        return retval;
+    }
+
+    plasma_future_t *f = (plasma_future_t*)malloc(sizeof(plasma_future_t));
+    if (f == NULL) {
+        plasma_error("malloc() failed");
+        free(args);
+        return PlasmaErrorOutOfMemory;
+    }
+    pthread_mutex_init(&f->mutex, NULL);
+    pthread_cond_init(&f->cond, NULL);
+    f->done = 0;
+    f->status = PlasmaSuccess;
+    f->run = run;
+    f->args = args;
+    f->callback = callback;
+    f->data = data;
+    f->next = NULL;
+    for (int i = 0; i < PLASMA_FUTURE_NUM_SETTINGS; i++)
+        plasma_get(plasma_future_params_g[i], &f->settings[i]);
+
+    struct plasma_executor_s *executor = plasma->executor;
+    pthread_mutex_lock(&executor->mutex);
+    if (executor->tail == NULL)
+        executor->head = f;
+    else
+        executor->tail->next = f;
+    executor->tail = f;
+    pthread_cond_signal(&executor->cond);
+    pthread_mutex_unlock(&executor->mutex);
+
+    *future = f;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_future
+    Tests for completion of an asynchronous driver call without blocking.
+
+    @retval 1 if the call has completed
+    @retval 0 if it is queued or running
+*/
+int plasma_future_test(plasma_future_t *future)
+{
+    if (future == NULL) {
+        plasma_error("NULL future");
+        return PlasmaErrorNullParameter;
+    }
+    pthread_mutex_lock(&future->mutex);
+    int done = future->done;
+    pthread_mutex_unlock(&future->mutex);
+    return done;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_future
+    Waits for completion of an asynchronous driver call.
+
+    @return The value returned by the synchronous driver.
+*/
+int plasma_future_wait(plasma_future_t *future)
+{
+    if (future == NULL) {
+        plasma_error("NULL future");
+        return PlasmaErrorNullParameter;
+    }
+    pthread_mutex_lock(&future->mutex);
+    while (! future->done)
+        pthread_cond_wait(&future->cond, &future->mutex);
+    int status = future->status;
+    pthread_mutex_unlock(&future->mutex);
+    return status;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_future
+    Waits for completion of an asynchronous driver call and frees its future.
+*/
+int plasma_future_destroy(plasma_future_t *future)
+{
+    if (future == NULL) {
+        plasma_error("NULL future");
+        return PlasmaErrorNullParameter;
+    }
+    plasma_future_wait(future);
+    pthread_cond_destroy(&future->cond);
+    pthread_mutex_destroy(&future->mutex);
+    free(future);
+    return PlasmaSuccess;
+}
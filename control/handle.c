@@ -0,0 +1,224 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_handle.h"
+#include "plasma_internal.h"
+
+/***************************************************************************//**
+    @ingroup plasma_handle
+    Creates a persistent handle for the m-by-n matrix pA in LAPACK layout.
+    Allocates the tile layout copy using the current tile size. The tile copy
+    is filled lazily by the first handle driver that uses it.
+*/
+int plasma_handle_create(plasma_enum_t precision, int m, int n,
+                         void *pA, int lda, plasma_handle_t *handle)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (handle == NULL) {
+        plasma_error("NULL handle");
+        return PlasmaErrorNullParameter;
+    }
+    if (m < 0 || n < 0) {
+        plasma_error("illegal matrix dimension");
+        return PlasmaErrorIllegalValue;
+    }
+    if (lda < imax(1, m)) {
+        plasma_error("illegal value of lda");
+        return PlasmaErrorIllegalValue;
+    }
+    if (pA == NULL && m > 0 && n > 0) {
+        plasma_error("NULL matrix");
+        return PlasmaErrorNullParameter;
+    }
+
+    int nb = plasma->nb;
+    int retval = plasma_desc_general_create(precision, nb, nb,
+                                            m, n, 0, 0, m, n, &handle->A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        return retval;
+    }
+    handle->pA = pA;
+    handle->lda = lda;
+    handle->state = PlasmaHandleLapackDirty;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_handle
+    Frees the tile layout copy. Does not synchronize the LAPACK copy;
+    call plasma_handle_sync() first if the results are needed.
+*/
+int plasma_handle_destroy(plasma_handle_t *handle)
+{
+    if (handle == NULL) {
+        plasma_error("NULL handle");
+        return PlasmaErrorNullParameter;
+    }
+    int retval = plasma_desc_destroy(&handle->A);
+    handle->A.matrix = NULL;
+    handle->pA = NULL;
+    handle->state = PlasmaHandleUnknown;
+    return retval;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_handle
+    Informs PLASMA that the user modified the LAPACK copy, so the tile copy
+    has to be refreshed before its next use.
+*/
+int plasma_handle_touch(plasma_handle_t *handle)
+{
+    if (handle == NULL) {
+        plasma_error("NULL handle");
+        return PlasmaErrorNullParameter;
+    }
+    handle->state = PlasmaHandleLapackDirty;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_handle
+    Makes the LAPACK copy current. Translates from tile layout only if a
+    handle driver modified the tile copy since the last synchronization.
+    This function must be called outside of any parallel region.
+*/
+int plasma_handle_sync(plasma_handle_t *handle)
+{
+    if (handle == NULL) {
+        plasma_error("NULL handle");
+        return PlasmaErrorNullParameter;
+    }
+    if (handle->state != PlasmaHandleTileDirty)
+        return PlasmaSuccess;
+
+    plasma_sequence_t sequence;
+    plasma_sequence_init(&sequence);
+    plasma_request_t request;
+    plasma_request_init(&request);
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        plasma_omp_handle_to_lapack(handle, &sequence, &request);
+    }
+    return sequence.status;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_handle
+    Checks that the handle is valid and holds a matrix of the given precision.
+*/
+int plasma_handle_check(plasma_handle_t *handle, plasma_enum_t precision)
+{
+    if (handle == NULL) {
+        plasma_error("NULL handle");
+        return PlasmaErrorNullParameter;
+    }
+    if (handle->state != PlasmaHandleSynced &&
+        handle->state != PlasmaHandleLapackDirty &&
+        handle->state != PlasmaHandleTileDirty) {
+        plasma_error("invalid handle state");
+        return PlasmaErrorIllegalValue;
+    }
+    if (handle->A.precision != precision) {
+        plasma_error("invalid handle precision");
+        return PlasmaErrorIllegalValue;
+    }
+    return plasma_desc_check(handle->A);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_handle
+    Inserts the tasks refreshing the tile copy, if it is stale.
+    Must be called inside the master region of a parallel region.
+*/
+void plasma_omp_handle_to_tile(plasma_handle_t *handle,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    if (handle->state != PlasmaHandleLapackDirty)
+        return;
+
+    switch (handle->A.precision) {
+    case PlasmaComplexDouble:
+        plasma_omp_zge2desc((plasma_complex64_t*)handle->pA, handle->lda,
+                            handle->A, sequence, request);
+        break;
+    case PlasmaComplexFloat:
+        plasma_omp_cge2desc((plasma_complex32_t*)handle->pA, handle->lda,
+                            handle->A, sequence, request);
+        break;
+    case PlasmaRealDouble:
+        plasma_omp_dge2desc((double*)handle->pA, handle->lda,
+                            handle->A, sequence, request);
+        break;
+    case PlasmaRealFloat:
+        plasma_omp_sge2desc((float*)handle->pA, handle->lda,
+                            handle->A, sequence, request);
+        break;
+    default:
+        plasma_error("invalid handle precision");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    handle->state = PlasmaHandleSynced;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_handle
+    Inserts the tasks refreshing the LAPACK copy, if it is stale.
+    Must be called inside the master region of a parallel region.
+*/
+void plasma_omp_handle_to_lapack(plasma_handle_t *handle,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    if (handle->state != PlasmaHandleTileDirty)
+        return;
+
+    switch (handle->A.precision) {
+    case PlasmaComplexDouble:
+        plasma_omp_zdesc2ge(handle->A, (plasma_complex64_t*)handle->pA,
+                            handle->lda, sequence, request);
+        break;
+    case PlasmaComplexFloat:
+        plasma_omp_cdesc2ge(handle->A, (plasma_complex32_t*)handle->pA,
+                            handle->lda, sequence, request);
+        break;
+    case PlasmaRealDouble:
+        plasma_omp_ddesc2ge(handle->A, (double*)handle->pA,
+                            handle->lda, sequence, request);
+        break;
+    case PlasmaRealFloat:
+        plasma_omp_sdesc2ge(handle->A, (float*)handle->pA,
+                            handle->lda, sequence, request);
+        break;
+    default:
+        plasma_error("invalid handle precision");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    handle->state = PlasmaHandleSynced;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_handle
+    Records that a handle driver modified the tile copy.
+*/
+void plasma_handle_tile_modified(plasma_handle_t *handle)
+{
+    handle->state = PlasmaHandleTileDirty;
+}
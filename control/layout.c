@@ -0,0 +1,246 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+// Parameters of the in-place permutations.
+// A permutation moves blocks (units) of eltsize*unit bytes.
+// The src() function returns the position a unit has to be fetched from.
+typedef struct {
+    int m;       // number of rows of the matrix (leading dimension in CM)
+    int mb;      // tile height
+    int w;       // panel width
+    int unit;    // number of elements in a unit
+    int forward; // CM -> CCRB if set, CCRB -> CM otherwise
+} plasma_panel_perm_t;
+
+typedef struct {
+    size_t ua;   // units in the full tiles of a panel
+    size_t ub;   // units in the bottom tile of a panel
+    size_t np;   // number of panels
+    int forward; // CM -> CCRB if set, CCRB -> CM otherwise
+} plasma_shuffle_perm_t;
+
+/******************************************************************************/
+static size_t gcd(size_t a, size_t b)
+{
+    while (b != 0) {
+        size_t t = a%b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/******************************************************************************/
+// Maps the position of an element within a column panel stored
+// column-major to its position within the panel stored as a column of tiles.
+static size_t panel_cm2tile(const plasma_panel_perm_t *p, size_t pos)
+{
+    size_t i = pos%p->m;
+    size_t j = pos/p->m;
+    size_t lm1 = p->m/p->mb;
+    size_t t = i/p->mb;
+    size_t h = t < lm1 ? (size_t)p->mb : (size_t)(p->m%p->mb);
+    return t*p->mb*p->w + i%p->mb + j*h;
+}
+
+// Inverse of panel_cm2tile().
+static size_t panel_tile2cm(const plasma_panel_perm_t *p, size_t pos)
+{
+    size_t m1 = p->m - p->m%p->mb;
+    if (pos < m1*p->w) {
+        size_t t = pos/((size_t)p->mb*p->w);
+        size_t r = pos%((size_t)p->mb*p->w);
+        return t*p->mb + r%p->mb + (r/p->mb)*p->m;
+    }
+    else {
+        size_t m2 = p->m%p->mb;
+        size_t r = pos - m1*p->w;
+        return m1 + r%m2 + (r/m2)*p->m;
+    }
+}
+
+static size_t panel_src(const void *args, size_t pos)
+{
+    const plasma_panel_perm_t *p = (const plasma_panel_perm_t*)args;
+    size_t e = p->unit;
+    if (p->forward)
+        return panel_tile2cm(p, pos*e)/e;
+    else
+        return panel_cm2tile(p, pos*e)/e;
+}
+
+/******************************************************************************/
+// Maps the position of a unit in the sequence of panels, each holding its
+// full tiles followed by its bottom tile, to its position in the sequence
+// holding all the full tiles followed by all the bottom tiles.
+static size_t shuffle_src(const void *args, size_t pos)
+{
+    const plasma_shuffle_perm_t *p = (const plasma_shuffle_perm_t*)args;
+    size_t u = p->ua + p->ub;
+    if (p->forward) {
+        if (pos < p->np*p->ua)
+            return (pos/p->ua)*u + pos%p->ua;
+        pos -= p->np*p->ua;
+        return (pos/p->ub)*u + p->ua + pos%p->ub;
+    }
+    else {
+        size_t k = pos/u;
+        size_t o = pos%u;
+        if (o < p->ua)
+            return k*p->ua + o;
+        return p->np*p->ua + k*p->ub + (o - p->ua);
+    }
+}
+
+/******************************************************************************/
+// Applies the permutation in place by following its cycles.
+// Uses one bit per unit to mark the units already in place
+// and a buffer of one unit to open each cycle.
+static int plasma_permute_cycles(char *base, size_t nunits, size_t usize,
+                                 size_t (*src)(const void*, size_t),
+                                 const void *args)
+{
+    size_t nwords = (nunits+63)/64;
+    uint64_t *done = (uint64_t*)calloc(nwords, sizeof(uint64_t));
+    char *tmp = (char*)malloc(usize);
+    if (done == NULL || tmp == NULL) {
+        free(done);
+        free(tmp);
+        return PlasmaErrorOutOfMemory;
+    }
+    for (size_t start = 0; start < nunits; start++) {
+        if (done[start/64] & ((uint64_t)1 << (start%64)))
+            continue;
+
+        size_t pos = start;
+        size_t next = src(args, pos);
+        if (next != start)
+            memcpy(tmp, base + start*usize, usize);
+
+        while (next != start) {
+            memcpy(base + pos*usize, base + next*usize, usize);
+            done[pos/64] |= (uint64_t)1 << (pos%64);
+            pos = next;
+            next = src(args, pos);
+        }
+        if (pos != start)
+            memcpy(base + pos*usize, tmp, usize);
+        done[pos/64] |= (uint64_t)1 << (pos%64);
+    }
+    free(done);
+    free(tmp);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Permutes the column panels of A, one task per panel.
+static void plasma_pge2desc_inplace_panels(plasma_desc_t A, int forward,
+                                           plasma_sequence_t *sequence,
+                                           plasma_request_t *request)
+{
+    size_t eltsize = plasma_element_size(A.precision);
+    int unit = (int)gcd(A.mb, A.gm);
+
+    for (int n = 0; n < A.gnt; n++) {
+        plasma_panel_perm_t perm;
+        perm.m = A.gm;
+        perm.mb = A.mb;
+        perm.w = imin(A.nb, A.gn - n*A.nb);
+        perm.unit = unit;
+        perm.forward = forward;
+        char *panel = (char*)A.matrix + (size_t)n*A.nb*A.gm*eltsize;
+
+        #pragma omp task firstprivate(perm, panel)
+        {
+            size_t nunits = (size_t)perm.m*perm.w/perm.unit;
+            int retval = plasma_permute_cycles(panel, nunits,
+                                               perm.unit*eltsize,
+                                               panel_src, &perm);
+            if (retval != PlasmaSuccess)
+                plasma_request_fail(sequence, request, retval);
+        }
+    }
+    #pragma omp taskwait
+}
+
+/******************************************************************************/
+// Moves the bottom tiles of the full column panels after their full tiles.
+static void plasma_pge2desc_inplace_shuffle(plasma_desc_t A, int forward,
+                                            plasma_sequence_t *sequence,
+                                            plasma_request_t *request)
+{
+    size_t m1 = A.gm - A.gm%A.mb;
+    size_t m2 = A.gm%A.mb;
+    size_t ln1 = A.gn/A.nb;
+    if (m1 == 0 || m2 == 0 || ln1 < 2)
+        return;
+
+    size_t unit = A.nb*gcd(m1, m2);
+    plasma_shuffle_perm_t perm;
+    perm.ua = m1*A.nb/unit;
+    perm.ub = m2*A.nb/unit;
+    perm.np = ln1;
+    perm.forward = forward;
+
+    int retval = plasma_permute_cycles(
+        (char*)A.matrix, perm.np*(perm.ua+perm.ub),
+        unit*plasma_element_size(A.precision), shuffle_src, &perm);
+    if (retval != PlasmaSuccess)
+        plasma_request_fail(sequence, request, retval);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_cm2ccrb
+
+    Convert column-major (CM) to tiled (CCRB) matrix layout.
+    In-place. The matrix of A has to hold the matrix in column-major layout
+    with the leading dimension A.gm, i.e., A has to be created by
+    plasma_desc_general_inplace_create().
+    Waits for all previously created tasks and for the permutation
+    to finish before returning. The permutation is applied even if the
+    sequence failed, so that it always pairs with plasma_pdesc2ge_inplace().
+*/
+void plasma_pge2desc_inplace(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request)
+{
+    #pragma omp taskwait
+    plasma_pge2desc_inplace_panels(A, 1, sequence, request);
+    plasma_pge2desc_inplace_shuffle(A, 1, sequence, request);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_ccrb2cm
+
+    Convert tiled (CCRB) to column-major (CM) matrix layout.
+    In-place. Inverse of plasma_pge2desc_inplace().
+    Waits for all previously created tasks and for the permutation
+    to finish before returning. The permutation is applied even if the
+    sequence failed, so that the matrix is always returned in column-major.
+*/
+void plasma_pdesc2ge_inplace(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request)
+{
+    #pragma omp taskwait
+    plasma_pge2desc_inplace_shuffle(A, 0, sequence, request);
+    plasma_pge2desc_inplace_panels(A, 0, sequence, request);
+}
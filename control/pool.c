@@ -0,0 +1,260 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_pool.h"
+#include "plasma_types.h"
+
+#include <stdlib.h>
+#include <sys/mman.h>
+
+/******************************************************************************/
+// Header preceding each buffer. Padded to fill a cache line.
+typedef union {
+    struct {
+        size_t size;      // size of the buffer, excluding the header
+        void *base;       // beginning of the allocation holding the buffer
+        size_t length;    // length of the allocation
+        size_t alignment; // alignment the buffer was allocated with
+        int huge_pages;   // huge pages policy the buffer was allocated with
+        int mapped;       // allocated by mmap() rather than posix_memalign()
+        int sclass;       // size class or -1 if too large to be cached
+        void *next;       // next buffer in the free list
+    } h;
+    char pad[64];
+} plasma_pool_header_t;
+
+/******************************************************************************/
+// Returns the size class of size, and its rounded up size in *rounded.
+static int plasma_pool_class(size_t size, size_t *rounded)
+{
+    size_t min = (size_t)1 << PLASMA_POOL_MIN_LOG2;
+    if (size < min)
+        size = min;
+
+    // the smallest e such that size <= 2^e
+    int e = 0;
+    while (e < 63 && ((size_t)1 << e) < size)
+        e++;
+
+    // 2^(e-1) < size <= 2^e is split into 8 steps of 2^(e-4)
+    size_t step = (size_t)1 << (e-4);
+    size_t steps = (size+step-1)/step; // in [9, 16]
+    *rounded = steps*step;
+
+    int sclass = (e-PLASMA_POOL_MIN_LOG2)*PLASMA_POOL_CLASS_STEPS +
+                 (int)steps - 9;
+    if (sclass >= PLASMA_POOL_NUM_CLASSES)
+        return -1;
+    return sclass;
+}
+
+/******************************************************************************/
+void plasma_pool_init(plasma_pool_t *pool)
+{
+    omp_init_lock(&pool->lock);
+    for (int i = 0; i < PLASMA_POOL_NUM_CLASSES; i++)
+        pool->free[i] = NULL;
+    pool->cached = 0;
+    pool->cap = (size_t)1024*1024*1024;
+    pool->enabled = PlasmaEnabled;
+    pool->alignment = PLASMA_POOL_ALIGNMENT;
+    pool->huge_pages = PlasmaHugePagesNone;
+}
+
+/******************************************************************************/
+// Allocates a buffer of size bytes with its header, aligned and backed by
+// huge pages according to the settings of the pool.
+static plasma_pool_header_t *plasma_pool_new(plasma_pool_t *pool, size_t size)
+{
+    // The header sits right before the buffer, whose offset
+    // from the beginning of the allocation is a multiple of the alignment.
+    size_t alignment = pool->alignment;
+    size_t offset = (sizeof(plasma_pool_header_t) + alignment-1)/
+                    alignment*alignment;
+    size_t length = offset + size;
+
+    void *base = NULL;
+    int mapped = 0;
+    if (pool->huge_pages != PlasmaHugePagesNone &&
+        size >= PLASMA_POOL_HUGE_PAGE) {
+        // Round up to whole huge pages.
+        length = (length + PLASMA_POOL_HUGE_PAGE-1)/
+                 PLASMA_POOL_HUGE_PAGE*PLASMA_POOL_HUGE_PAGE;
+#if defined(MAP_HUGETLB)
+        if (pool->huge_pages == PlasmaHugePagesExplicit) {
+            base = mmap(NULL, length, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (base == MAP_FAILED)
+                base = NULL;
+            else
+                mapped = 1;
+        }
+#endif
+        if (base == NULL) {
+            if (posix_memalign(&base, PLASMA_POOL_HUGE_PAGE, length) != 0)
+                return NULL;
+#if defined(MADV_HUGEPAGE)
+            // Only a hint, the buffer is still usable if it fails.
+            madvise(base, length, MADV_HUGEPAGE);
+#endif
+        }
+    }
+    else {
+        if (posix_memalign(&base, alignment, length) != 0)
+            return NULL;
+    }
+
+    plasma_pool_header_t *header =
+        (plasma_pool_header_t*)((char*)base + offset) - 1;
+    header->h.size = size;
+    header->h.base = base;
+    header->h.length = length;
+    header->h.alignment = alignment;
+    header->h.huge_pages = pool->huge_pages;
+    header->h.mapped = mapped;
+    return header;
+}
+
+/******************************************************************************/
+// Frees the allocation holding the buffer.
+static void plasma_pool_delete(plasma_pool_header_t *header)
+{
+    if (header == NULL)
+        return;
+
+    if (header->h.mapped)
+        munmap(header->h.base, header->h.length);
+    else
+        free(header->h.base);
+}
+
+/******************************************************************************/
+void plasma_pool_finalize(plasma_pool_t *pool)
+{
+    plasma_pool_release(pool);
+    omp_destroy_lock(&pool->lock);
+}
+
+/***************************************************************************//**
+    Frees all the cached buffers.
+*/
+void plasma_pool_release(plasma_pool_t *pool)
+{
+    omp_set_lock(&pool->lock);
+    for (int i = 0; i < PLASMA_POOL_NUM_CLASSES; i++) {
+        plasma_pool_header_t *header = (plasma_pool_header_t*)pool->free[i];
+        while (header != NULL) {
+            plasma_pool_header_t *next = (plasma_pool_header_t*)header->h.next;
+            plasma_pool_delete(header);
+            header = next;
+        }
+        pool->free[i] = NULL;
+    }
+    pool->cached = 0;
+    omp_unset_lock(&pool->lock);
+}
+
+/***************************************************************************//**
+    Sets the limit on the cached bytes. Releases the cached buffers
+    if they exceed the new limit.
+*/
+void plasma_pool_set_cap(plasma_pool_t *pool, size_t cap)
+{
+    omp_set_lock(&pool->lock);
+    pool->cap = cap;
+    int over = pool->cached > cap;
+    omp_unset_lock(&pool->lock);
+    if (over)
+        plasma_pool_release(pool);
+}
+
+/***************************************************************************//**
+    Sets the alignment of the buffers in bytes, a power of two.
+    Releases the cached buffers, allocated with the previous alignment.
+*/
+void plasma_pool_set_alignment(plasma_pool_t *pool, size_t alignment)
+{
+    omp_set_lock(&pool->lock);
+    pool->alignment = alignment;
+    omp_unset_lock(&pool->lock);
+    plasma_pool_release(pool);
+}
+
+/***************************************************************************//**
+    Sets the huge pages policy of the buffers (PlasmaHugePages).
+    Releases the cached buffers, allocated with the previous policy.
+*/
+void plasma_pool_set_huge_pages(plasma_pool_t *pool, int huge_pages)
+{
+    omp_set_lock(&pool->lock);
+    pool->huge_pages = huge_pages;
+    omp_unset_lock(&pool->lock);
+    plasma_pool_release(pool);
+}
+
+/***************************************************************************//**
+    Allocates a buffer of size bytes, reusing a cached buffer of the same
+    size class if there is one. Returns NULL if out of memory.
+    The buffer has to be freed by plasma_pool_free().
+*/
+void *plasma_pool_alloc(plasma_pool_t *pool, size_t size)
+{
+    size_t rounded;
+    int sclass = plasma_pool_class(size, &rounded);
+
+    plasma_pool_header_t *header = NULL;
+    if (sclass >= 0) {
+        omp_set_lock(&pool->lock);
+        header = (plasma_pool_header_t*)pool->free[sclass];
+        if (header != NULL) {
+            pool->free[sclass] = header->h.next;
+            pool->cached -= header->h.size;
+        }
+        omp_unset_lock(&pool->lock);
+    }
+    else {
+        rounded = size;
+    }
+    if (header == NULL) {
+        header = plasma_pool_new(pool, rounded);
+        if (header == NULL)
+            return NULL;
+        header->h.sclass = sclass;
+    }
+    header->h.next = NULL;
+    return (void*)(header+1);
+}
+
+/***************************************************************************//**
+    Returns a buffer allocated by plasma_pool_alloc() to the pool,
+    or frees it if the pool is disabled or full, or if the buffer was
+    allocated with other alignment or huge pages settings.
+*/
+void plasma_pool_free(plasma_pool_t *pool, void *ptr)
+{
+    if (ptr == NULL)
+        return;
+
+    plasma_pool_header_t *header = (plasma_pool_header_t*)ptr - 1;
+    if (header->h.sclass >= 0) {
+        omp_set_lock(&pool->lock);
+        if (pool->enabled == PlasmaEnabled &&
+            pool->cached + header->h.size <= pool->cap &&
+            header->h.alignment == pool->alignment &&
+            header->h.huge_pages == pool->huge_pages) {
+            header->h.next = pool->free[header->h.sclass];
+            pool->free[header->h.sclass] = header;
+            pool->cached += header->h.size;
+            header = NULL;
+        }
+        omp_unset_lock(&pool->lock);
+    }
+    plasma_pool_delete(header);
+}
@@ -0,0 +1,115 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_static.h"
+#include "plasma_internal.h"
+
+#include <omp.h>
+#include <sched.h>
+#include <stdlib.h>
+
+/******************************************************************************/
+// Maps the tiles to the threads by columns.
+plasma_static_grid_t plasma_static_grid_1d(int size)
+{
+    plasma_static_grid_t grid = { 1, imax(size, 1) };
+    return grid;
+}
+
+/******************************************************************************/
+// Maps the tiles to the threads in 2D, on the squarest p x q grid
+// with p*q = size and p <= q.
+plasma_static_grid_t plasma_static_grid_2d(int size)
+{
+    plasma_static_grid_t grid = { 1, imax(size, 1) };
+    for (int p = 2; p*p <= size; p++) {
+        if (size % p == 0) {
+            grid.p = p;
+            grid.q = size/p;
+        }
+    }
+    return grid;
+}
+
+/******************************************************************************/
+// Allocates the m x n progress table of the context, cleared,
+// and resets the abort flag.
+int plasma_static_init(plasma_context_t *plasma, int m, int n)
+{
+    size_t size = (size_t)imax(m, 1)*imax(n, 1);
+    plasma->ss_progress = (volatile int*)calloc(size, sizeof(int));
+    if (plasma->ss_progress == NULL) {
+        plasma_error("calloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    plasma->ss_ld = imax(m, 1);
+    plasma->ss_abort = 0;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void plasma_static_finalize(plasma_context_t *plasma)
+{
+    free((void*)plasma->ss_progress);
+    plasma->ss_progress = NULL;
+}
+
+/******************************************************************************/
+// Publishes the progress of entry (m, n), after the data written before.
+void plasma_static_set(plasma_context_t *plasma, int m, int n, int val)
+{
+    #pragma omp flush
+    plasma->ss_progress[m + plasma->ss_ld*n] = val;
+    #pragma omp flush
+}
+
+/******************************************************************************/
+// Waits until entry (m, n) reaches val.
+// Returns nonzero if the run was aborted.
+int plasma_static_wait(plasma_context_t *plasma, int m, int n, int val)
+{
+    int spins = 0;
+    while (plasma->ss_progress[m + plasma->ss_ld*n] < val) {
+        if (plasma->ss_abort)
+            return 1;
+        if (++spins > 64)
+            sched_yield();
+        #pragma omp flush
+    }
+    #pragma omp flush
+    return 0;
+}
+
+/******************************************************************************/
+// Releases the threads waiting, e.g., after a failure of a kernel.
+void plasma_static_abort(plasma_context_t *plasma)
+{
+    plasma->ss_abort = 1;
+    #pragma omp flush
+}
+
+/******************************************************************************/
+// Runs worker on all threads of the current team at once, with ranks
+// 0 to size-1. Called by the master thread of the parallel region of a
+// driver, which runs rank 0. Tasks created before are completed first,
+// so the other threads are free to take the ranks left.
+void plasma_static_run(void (*worker)(int rank, int size, void *arg),
+                       void *arg)
+{
+    #pragma omp taskwait
+
+    int size = omp_get_num_threads();
+    for (int rank = 1; rank < size; rank++) {
+        #pragma omp task firstprivate(rank)
+        worker(rank, size, arg);
+    }
+    worker(0, size, arg);
+    #pragma omp taskwait
+}
@@ -0,0 +1,243 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_stats.h"
+#include "plasma_error.h"
+#include "plasma_trace.h"
+#include "plasma_types.h"
+
+#include <string.h>
+#include <omp.h>
+
+/******************************************************************************/
+volatile int plasma_stats_enabled_g = 0;
+
+// Calls of the routines, updated by the drivers in the plasma_stats
+// critical section.
+static plasma_stats_routine_t
+    plasma_stats_routines_g[PLASMA_STATS_MAX_ROUTINES];
+static int plasma_stats_num_routines_g = 0;
+static int plasma_stats_num_threads_g = 0;
+static double plasma_stats_team_time_g = 0.0;
+
+// Names of the kernels, appended in the plasma_stats critical section and
+// read without locks.
+static const char *plasma_stats_kernel_names_g[PLASMA_STATS_MAX_KERNELS];
+static int plasma_stats_num_kernels_g = 0;
+
+// Tasks and clock ticks of each kernel, per thread of the team.
+typedef struct {
+    uint64_t tasks[PLASMA_STATS_MAX_KERNELS];
+    uint64_t ticks[PLASMA_STATS_MAX_KERNELS];
+} plasma_stats_thread_t;
+
+static plasma_stats_thread_t plasma_stats_threads_g[PLASMA_STATS_MAX_THREADS];
+
+/******************************************************************************/
+// Returns the index of the kernel, adding it if new, -1 if the table is full.
+static int plasma_stats_kernel_index(const char *name)
+{
+    int num_kernels = __atomic_load_n(&plasma_stats_num_kernels_g,
+                                      __ATOMIC_ACQUIRE);
+    for (int k = 0; k < num_kernels; k++)
+        if (plasma_stats_kernel_names_g[k] == name ||
+            strcmp(plasma_stats_kernel_names_g[k], name) == 0)
+            return k;
+
+    int index = -1;
+    #pragma omp critical(plasma_stats)
+    {
+        int k;
+        for (k = num_kernels; k < plasma_stats_num_kernels_g; k++)
+            if (strcmp(plasma_stats_kernel_names_g[k], name) == 0)
+                break;
+        if (k < plasma_stats_num_kernels_g) {
+            index = k;
+        }
+        else if (k < PLASMA_STATS_MAX_KERNELS) {
+            plasma_stats_kernel_names_g[k] = name;
+            __atomic_store_n(&plasma_stats_num_kernels_g, k+1,
+                             __ATOMIC_RELEASE);
+            index = k;
+        }
+    }
+    return index;
+}
+
+/******************************************************************************/
+// Counts a task of the kernel run by the calling thread.
+void plasma_stats_kernel(const char *name, uint64_t start, uint64_t stop)
+{
+    int thread = omp_get_thread_num();
+    if (thread >= PLASMA_STATS_MAX_THREADS)
+        return;
+    int k = plasma_stats_kernel_index(name);
+    if (k < 0)
+        return;
+
+    // Application threads calling PLASMA at the same time share the slots
+    // of their team ranks.
+    plasma_stats_thread_t *counts = &plasma_stats_threads_g[thread];
+    __atomic_fetch_add(&counts->tasks[k], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&counts->ticks[k], stop-start, __ATOMIC_RELAXED);
+}
+
+/******************************************************************************/
+// Returns the start of a driver call, 0 if statistics are off.
+double plasma_stats_start()
+{
+    return plasma_stats_enabled_g ? omp_get_wtime() : 0.0;
+}
+
+/******************************************************************************/
+// Counts a call of the routine started by plasma_stats_start().
+void plasma_stats_stop(const char *name, double flops, double start)
+{
+    if (start == 0.0)
+        return;
+    double time = omp_get_wtime()-start;
+    int num_threads = omp_get_max_threads();
+
+    #pragma omp critical(plasma_stats)
+    {
+        int r;
+        for (r = 0; r < plasma_stats_num_routines_g; r++)
+            if (strcmp(plasma_stats_routines_g[r].name, name) == 0)
+                break;
+        if (r == plasma_stats_num_routines_g &&
+            r < PLASMA_STATS_MAX_ROUTINES) {
+            plasma_stats_routines_g[r].name = name;
+            plasma_stats_routines_g[r].calls = 0;
+            plasma_stats_routines_g[r].time = 0.0;
+            plasma_stats_routines_g[r].flops = 0.0;
+            plasma_stats_num_routines_g++;
+        }
+        if (r < plasma_stats_num_routines_g) {
+            plasma_stats_routines_g[r].calls++;
+            plasma_stats_routines_g[r].time += time;
+            plasma_stats_routines_g[r].flops += flops;
+        }
+        if (num_threads > plasma_stats_num_threads_g)
+            plasma_stats_num_threads_g = num_threads;
+        plasma_stats_team_time_g += time*num_threads;
+    }
+}
+
+/***************************************************************************//**
+    @ingroup plasma_stats
+    Turns the statistics of the calls and their tasks on or off.
+    Same as plasma_set(PlasmaStats, enabled).
+*/
+void plasma_stats_enable(int enabled)
+{
+    if (enabled)
+        plasma_trace_calibrate();
+    plasma_stats_enabled_g = enabled;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_stats
+    Returns the statistics gathered since the last plasma_reset_stats(),
+    while plasma_set(PlasmaStats, PlasmaEnabled) was in effect:
+
+    - per routine, the number of calls, their wall time and flops,
+      from the formulas the tester uses;
+    - per kernel, the number of tasks and the time spent in them;
+    - per thread of the team, the number of tasks and the time spent
+      in them;
+    - in total, the wall time, the flops, and the idle time, that is
+      the wall time of the calls times the size of their team minus the
+      time spent in tasks.
+
+    Only the LAPACK layout drivers of BLAS 3 routines and of the LU,
+    Cholesky, QR and LQ factorizations and solvers are counted. Calls are
+    timed from the tuning of parameters to the translation back to LAPACK
+    layout. Application threads calling PLASMA concurrently add up in the
+    same statistics.
+    This function must be called outside of any parallel region.
+
+ * @param[out] stats
+ *          On exit, the statistics.
+ *
+ * @retval PlasmaSuccess successful exit
+ */
+int plasma_get_stats(plasma_stats_t *stats)
+{
+    if (stats == NULL) {
+        plasma_error("NULL stats");
+        return PlasmaErrorNullParameter;
+    }
+    memset(stats, 0, sizeof(plasma_stats_t));
+    double ticks_per_us = plasma_trace_ticks_per_us();
+
+    #pragma omp critical(plasma_stats)
+    {
+        stats->num_routines = plasma_stats_num_routines_g;
+        for (int r = 0; r < stats->num_routines; r++) {
+            plasma_stats_routine_t *routine = &stats->routines[r];
+            *routine = plasma_stats_routines_g[r];
+            routine->gflops =
+                routine->time > 0.0 ? routine->flops/routine->time/1e9 : 0.0;
+            stats->time += routine->time;
+            stats->flops += routine->flops;
+        }
+        stats->num_threads = plasma_stats_num_threads_g;
+        if (stats->num_threads > PLASMA_STATS_MAX_THREADS)
+            stats->num_threads = PLASMA_STATS_MAX_THREADS;
+
+        // Kernels without tasks since the reset are left out.
+        double busy = 0.0;
+        for (int k = 0; k < plasma_stats_num_kernels_g; k++) {
+            plasma_stats_kernel_t *kernel =
+                &stats->kernels[stats->num_kernels];
+            kernel->name = plasma_stats_kernel_names_g[k];
+            for (int t = 0; t < PLASMA_STATS_MAX_THREADS; t++) {
+                plasma_stats_thread_t *counts = &plasma_stats_threads_g[t];
+                double time = counts->ticks[k]/ticks_per_us/1e6;
+                kernel->tasks += counts->tasks[k];
+                kernel->time += time;
+                if (t < stats->num_threads) {
+                    stats->tasks[t] += counts->tasks[k];
+                    stats->busy[t] += time;
+                }
+                busy += time;
+            }
+            if (kernel->tasks > 0)
+                stats->num_kernels++;
+            else
+                kernel->name = NULL;
+        }
+        stats->idle = plasma_stats_team_time_g-busy;
+        if (stats->idle < 0.0)
+            stats->idle = 0.0;
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_stats
+    Discards the statistics gathered so far.
+    This function must be called outside of any parallel region.
+*/
+void plasma_reset_stats()
+{
+    #pragma omp critical(plasma_stats)
+    {
+        plasma_stats_num_routines_g = 0;
+        plasma_stats_num_threads_g = 0;
+        plasma_stats_team_time_g = 0.0;
+        for (int t = 0; t < PLASMA_STATS_MAX_THREADS; t++) {
+            for (int k = 0; k < plasma_stats_num_kernels_g; k++) {
+                plasma_stats_threads_g[t].tasks[k] = 0;
+                plasma_stats_threads_g[t].ticks[k] = 0;
+            }
+        }
+    }
+}
@@ -0,0 +1,412 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_trace.h"
+#include "plasma_error.h"
+#include "plasma_types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+/******************************************************************************/
+// Default number of events kept per thread, PLASMA_TRACE_EVENTS.
+#define PLASMA_TRACE_EVENTS 65536
+
+volatile int plasma_trace_enabled_g = 0;
+
+// Buffers of all threads that recorded events.
+static plasma_trace_buffer_t *plasma_trace_buffers_g = NULL;
+static int plasma_trace_num_threads_g = 0;
+
+// Buffer of the calling thread, NULL before its first event.
+static __thread plasma_trace_buffer_t *plasma_trace_buffer_tl = NULL;
+
+// Clock and wall time when tracing was first enabled, calibrating the clock.
+static uint64_t plasma_trace_clock0_g = 0;
+static double plasma_trace_wtime0_g = 0.0;
+
+// Files written by plasma_trace_finalize(), from PLASMA_TRACE and
+// PLASMA_TRACE_SUMMARY.
+static char *plasma_trace_filename_g = NULL;
+static char *plasma_trace_summary_filename_g = NULL;
+
+/******************************************************************************/
+// Allocates the buffer of the calling thread and adds it to the list.
+static plasma_trace_buffer_t *plasma_trace_buffer_create()
+{
+    int size = PLASMA_TRACE_EVENTS;
+    char *events = getenv("PLASMA_TRACE_EVENTS");
+    if (events != NULL && atoi(events) > 0) {
+        size = 1;
+        while (size < atoi(events))
+            size *= 2;
+    }
+
+    plasma_trace_buffer_t *buffer =
+        (plasma_trace_buffer_t*)malloc(sizeof(plasma_trace_buffer_t));
+    if (buffer == NULL)
+        return NULL;
+    buffer->events =
+        (plasma_trace_event_t*)malloc(size*sizeof(plasma_trace_event_t));
+    if (buffer->events == NULL) {
+        free(buffer);
+        return NULL;
+    }
+    buffer->size = size;
+    buffer->count = 0;
+    buffer->thread = __atomic_fetch_add(&plasma_trace_num_threads_g, 1,
+                                        __ATOMIC_RELAXED);
+
+    buffer->next = __atomic_load_n(&plasma_trace_buffers_g, __ATOMIC_RELAXED);
+    while (! __atomic_compare_exchange_n(&plasma_trace_buffers_g,
+                                         &buffer->next, buffer, 0,
+                                         __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;
+    plasma_trace_buffer_tl = buffer;
+    return buffer;
+}
+
+/******************************************************************************/
+// Counts an event in the statistics and records it in the buffer of the
+// calling thread.
+void plasma_trace_event(const char *name, const void *tile, int m, int n,
+                        uint64_t start, uint64_t stop)
+{
+    if (plasma_stats_enabled_g)
+        plasma_stats_kernel(name, start, stop);
+    if (! plasma_trace_enabled_g)
+        return;
+
+    plasma_trace_buffer_t *buffer = plasma_trace_buffer_tl;
+    if (buffer == NULL) {
+        buffer = plasma_trace_buffer_create();
+        if (buffer == NULL)
+            return;
+    }
+    uint64_t count = buffer->count;
+    plasma_trace_event_t *event = &buffer->events[count & (buffer->size-1)];
+    event->name = name;
+    event->tile = tile;
+    event->m = m;
+    event->n = n;
+    event->start = start;
+    event->stop = stop;
+    __atomic_store_n(&buffer->count, count+1, __ATOMIC_RELEASE);
+}
+
+/******************************************************************************/
+// Returns the first event kept in the buffer and sets num_events.
+static plasma_trace_event_t *plasma_trace_buffer_events(
+    plasma_trace_buffer_t *buffer, uint64_t *first, int *num_events)
+{
+    uint64_t count = __atomic_load_n(&buffer->count, __ATOMIC_ACQUIRE);
+    *first = count > (uint64_t)buffer->size ? count-buffer->size : 0;
+    *num_events = (int)(count-*first);
+    return buffer->events;
+}
+
+/******************************************************************************/
+// Starts measuring the clock against the wall time, once.
+void plasma_trace_calibrate()
+{
+    if (plasma_trace_clock0_g == 0) {
+        plasma_trace_wtime0_g = omp_get_wtime();
+        plasma_trace_clock0_g = plasma_trace_clock();
+    }
+}
+
+/******************************************************************************/
+// Returns the clock ticks per microsecond, measured since the first
+// plasma_trace_calibrate(), over at least 10 ms.
+double plasma_trace_ticks_per_us()
+{
+    if (plasma_trace_clock0_g == 0)
+        return 1.0;
+    while (omp_get_wtime()-plasma_trace_wtime0_g < 0.01)
+        ;
+    double wtime = omp_get_wtime();
+    uint64_t clock = plasma_trace_clock();
+    return (double)(clock-plasma_trace_clock0_g) /
+           ((wtime-plasma_trace_wtime0_g)*1e6);
+}
+
+/******************************************************************************/
+// Returns the earliest start and latest stop of the events kept.
+static int plasma_trace_span(uint64_t *begin, uint64_t *end)
+{
+    int found = 0;
+    plasma_trace_buffer_t *buffer =
+        __atomic_load_n(&plasma_trace_buffers_g, __ATOMIC_ACQUIRE);
+    for (; buffer != NULL; buffer = buffer->next) {
+        uint64_t first;
+        int num_events;
+        plasma_trace_event_t *events =
+            plasma_trace_buffer_events(buffer, &first, &num_events);
+        for (int i = 0; i < num_events; i++) {
+            plasma_trace_event_t *event =
+                &events[(first+i) & (buffer->size-1)];
+            if (! found || event->start < *begin)
+                *begin = event->start;
+            if (! found || event->stop > *end)
+                *end = event->stop;
+            found = 1;
+        }
+    }
+    return found;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_trace
+    Turns the recording of task events on or off, in all threads.
+    Same as plasma_set(PlasmaTrace, enabled).
+*/
+void plasma_trace_enable(int enabled)
+{
+    if (enabled)
+        plasma_trace_calibrate();
+    plasma_trace_enabled_g = enabled;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_trace
+    Writes the events recorded so far as a Chrome trace (JSON), which
+    chrome://tracing and the Perfetto UI display, one row per thread.
+    Times are in microseconds from the first event. Each event has the
+    address and size of the tile the task wrote in its arguments.
+    This function must be called outside of any parallel region.
+*/
+int plasma_trace_write(const char *filename)
+{
+    if (filename == NULL) {
+        plasma_error("NULL filename");
+        return PlasmaErrorNullParameter;
+    }
+    FILE *file = fopen(filename, "w");
+    if (file == NULL) {
+        plasma_error("cannot write trace");
+        return PlasmaErrorIllegalValue;
+    }
+
+    double ticks_per_us = plasma_trace_ticks_per_us();
+    uint64_t begin = 0, end = 0;
+    plasma_trace_span(&begin, &end);
+
+    fprintf(file, "{\"traceEvents\":[\n");
+    const char *separator = "";
+    plasma_trace_buffer_t *buffer =
+        __atomic_load_n(&plasma_trace_buffers_g, __ATOMIC_ACQUIRE);
+    for (; buffer != NULL; buffer = buffer->next) {
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                "\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+                separator, buffer->thread, buffer->thread);
+        separator = ",\n";
+
+        uint64_t first;
+        int num_events;
+        plasma_trace_event_t *events =
+            plasma_trace_buffer_events(buffer, &first, &num_events);
+        for (int i = 0; i < num_events; i++) {
+            plasma_trace_event_t *event =
+                &events[(first+i) & (buffer->size-1)];
+            fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"plasma\","
+                    "\"ph\":\"X\",\"pid\":0,\"tid\":%d,"
+                    "\"ts\":%.3f,\"dur\":%.3f,"
+                    "\"args\":{\"tile\":\"%p\",\"m\":%d,\"n\":%d}}",
+                    event->name, buffer->thread,
+                    (event->start-begin)/ticks_per_us,
+                    (event->stop-event->start)/ticks_per_us,
+                    event->tile, event->m, event->n);
+        }
+    }
+    fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    if (fclose(file) != 0) {
+        plasma_error("cannot write trace");
+        return PlasmaErrorIllegalValue;
+    }
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Statistics of the events of one kernel.
+typedef struct {
+    const char *name;
+    int count;
+    double total;   // us
+    double min;
+    double max;
+} plasma_trace_kernel_t;
+
+/***************************************************************************//**
+    @ingroup plasma_trace
+    Writes a summary of the events recorded so far: per kernel, the number
+    of tasks and their total, mean, minimum and maximum times, then per
+    thread, the time spent in tasks and idle between the first start and
+    the last stop of all events. Writes to the standard output if filename
+    is NULL. This function must be called outside of any parallel region.
+*/
+int plasma_trace_summary(const char *filename)
+{
+    FILE *file = stdout;
+    if (filename != NULL) {
+        file = fopen(filename, "w");
+        if (file == NULL) {
+            plasma_error("cannot write trace summary");
+            return PlasmaErrorIllegalValue;
+        }
+    }
+
+    double ticks_per_us = plasma_trace_ticks_per_us();
+    uint64_t begin = 0, end = 0;
+    plasma_trace_span(&begin, &end);
+    double span = (end-begin)/ticks_per_us;
+
+    int num_kernels = 0;
+    int max_kernels = 0;
+    plasma_trace_kernel_t *kernels = NULL;
+    int num_tasks = 0;
+    int num_threads = 0;
+    uint64_t num_dropped = 0;
+    int retval = PlasmaSuccess;
+
+    plasma_trace_buffer_t *buffer =
+        __atomic_load_n(&plasma_trace_buffers_g, __ATOMIC_ACQUIRE);
+    for (; buffer != NULL && retval == PlasmaSuccess; buffer = buffer->next) {
+        uint64_t first;
+        int num_events;
+        plasma_trace_event_t *events =
+            plasma_trace_buffer_events(buffer, &first, &num_events);
+        num_dropped += first;
+        num_tasks += num_events;
+        num_threads++;
+        for (int i = 0; i < num_events; i++) {
+            plasma_trace_event_t *event =
+                &events[(first+i) & (buffer->size-1)];
+            double time = (event->stop-event->start)/ticks_per_us;
+            int k;
+            for (k = 0; k < num_kernels; k++)
+                if (strcmp(kernels[k].name, event->name) == 0)
+                    break;
+            if (k == num_kernels) {
+                if (num_kernels == max_kernels) {
+                    max_kernels = max_kernels == 0 ? 32 : 2*max_kernels;
+                    plasma_trace_kernel_t *realloced =
+                        (plasma_trace_kernel_t*)realloc(
+                            kernels,
+                            max_kernels*sizeof(plasma_trace_kernel_t));
+                    if (realloced == NULL) {
+                        plasma_error("realloc() failed");
+                        retval = PlasmaErrorOutOfMemory;
+                        break;
+                    }
+                    kernels = realloced;
+                }
+                kernels[k].name = event->name;
+                kernels[k].count = 0;
+                kernels[k].total = 0.0;
+                kernels[k].min = time;
+                kernels[k].max = time;
+                num_kernels++;
+            }
+            kernels[k].count++;
+            kernels[k].total += time;
+            if (time < kernels[k].min)
+                kernels[k].min = time;
+            if (time > kernels[k].max)
+                kernels[k].max = time;
+        }
+    }
+
+    if (retval == PlasmaSuccess) {
+        fprintf(file, "# PLASMA trace: %d tasks on %d threads over %.3f ms",
+                num_tasks, num_threads, span/1e3);
+        if (num_dropped > 0)
+            fprintf(file, ", %llu oldest events overwritten",
+                    (unsigned long long)num_dropped);
+        fprintf(file, "\n");
+
+        fprintf(file, "# %-22s %8s %12s %10s %10s %10s\n",
+                "kernel", "tasks", "total_ms", "mean_us", "min_us", "max_us");
+        for (int k = 0; k < num_kernels; k++) {
+            fprintf(file, "  %-22s %8d %12.3f %10.2f %10.2f %10.2f\n",
+                    kernels[k].name, kernels[k].count, kernels[k].total/1e3,
+                    kernels[k].total/kernels[k].count,
+                    kernels[k].min, kernels[k].max);
+        }
+
+        fprintf(file, "# %-22s %8s %12s %10s %10s\n",
+                "thread", "tasks", "busy_ms", "idle_ms", "busy_%");
+        buffer = __atomic_load_n(&plasma_trace_buffers_g, __ATOMIC_ACQUIRE);
+        for (; buffer != NULL; buffer = buffer->next) {
+            uint64_t first;
+            int num_events;
+            plasma_trace_event_t *events =
+                plasma_trace_buffer_events(buffer, &first, &num_events);
+            double busy = 0.0;
+            for (int i = 0; i < num_events; i++) {
+                plasma_trace_event_t *event =
+                    &events[(first+i) & (buffer->size-1)];
+                busy += (event->stop-event->start)/ticks_per_us;
+            }
+            fprintf(file, "  %-22d %8d %12.3f %10.3f %10.1f\n",
+                    buffer->thread, num_events, busy/1e3, (span-busy)/1e3,
+                    span > 0.0 ? 100.0*busy/span : 0.0);
+        }
+    }
+    free(kernels);
+
+    if (file != stdout && fclose(file) != 0) {
+        plasma_error("cannot write trace summary");
+        return PlasmaErrorIllegalValue;
+    }
+    return retval;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_trace
+    Discards the events recorded so far.
+    This function must be called outside of any parallel region.
+*/
+void plasma_trace_clear()
+{
+    plasma_trace_buffer_t *buffer =
+        __atomic_load_n(&plasma_trace_buffers_g, __ATOMIC_ACQUIRE);
+    for (; buffer != NULL; buffer = buffer->next)
+        __atomic_store_n(&buffer->count, 0, __ATOMIC_RELEASE);
+}
+
+/******************************************************************************/
+// Turns tracing on if PLASMA_TRACE or PLASMA_TRACE_SUMMARY name files,
+// written by plasma_trace_finalize().
+void plasma_trace_init()
+{
+    char *filename = getenv("PLASMA_TRACE");
+    char *summary_filename = getenv("PLASMA_TRACE_SUMMARY");
+    if (filename != NULL && plasma_trace_filename_g == NULL)
+        plasma_trace_filename_g = strdup(filename);
+    if (summary_filename != NULL && plasma_trace_summary_filename_g == NULL)
+        plasma_trace_summary_filename_g = strdup(summary_filename);
+    if (plasma_trace_filename_g != NULL ||
+        plasma_trace_summary_filename_g != NULL)
+        plasma_trace_enable(PlasmaEnabled);
+}
+
+/******************************************************************************/
+// Writes the files named by PLASMA_TRACE and PLASMA_TRACE_SUMMARY with the
+// events recorded so far.
+void plasma_trace_finalize()
+{
+    if (plasma_trace_filename_g != NULL)
+        plasma_trace_write(plasma_trace_filename_g);
+    if (plasma_trace_summary_filename_g != NULL)
+        plasma_trace_summary(plasma_trace_summary_filename_g);
+}
@@ -7,6 +7,7 @@
  *  University of Manchester, UK.
  **/
 
+#include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_tree.h"
@@ -78,11 +79,14 @@ void plasma_tree_operations(int mt, int nt,
                             plasma_sequence_t *sequence,
                             plasma_request_t *request)
 {
-    // Different algorithms can be implemented and switched here.
-    const int tree_type = PlasmaTreeBlockGreedy;
-
-    // Number of cores is useful for some algorithms.
-    int ncores = omp_get_num_threads();
+    // The tree is selected by PlasmaHouseholderTree.
+    plasma_context_t *plasma = plasma_context_self();
+    int tree_type = plasma->householder_tree;
+
+    // Number of cores is useful for some algorithms. Outside of a parallel
+    // region, e.g., in a dry run, it is the size of the next team.
+    int ncores = omp_in_parallel() ? omp_get_num_threads()
+                                   : omp_get_max_threads();
 
     switch (tree_type) {
         case PlasmaTreeFlatTs:
@@ -17,18 +17,457 @@
 #include <assert.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <omp.h>
 
+/******************************************************************************/
+// Tuned parameters of a routine in one precision, for one number of threads
+// and one size bucket. Zero values were not tuned.
+typedef struct {
+    char routine[16];      // getrf, potrf, etc.
+    plasma_enum_t dtyp;    // PlasmaRealDouble, etc.
+    int num_threads;       // omp_get_max_threads() when tuned
+    int bucket;            // plasma_tuning_bucket() of the size
+    int nb;
+    int ib;
+    int max_panel_threads;
+    int small;             // PlasmaSmallSize threshold, -1 for none
+} plasma_tuning_entry_t;
+
+// Most size arguments of a plasma_tune_* function and number of
+// memoized tuning decisions.
+#define PLASMA_TUNING_MAX_ARGS 5
+#define PLASMA_TUNING_MEMO_SIZE 256
+
+// Memoized tuning decision.
+typedef struct {
+    const char *func_name;                // NULL if the slot is empty
+    plasma_enum_t dtyp;
+    int num_threads;
+    int count;
+    int buckets[PLASMA_TUNING_MAX_ARGS];  // buckets of the size arguments
+    int found;                            // whether there is a tuned value
+    int value;
+} plasma_tuning_memo_t;
+
+// Tuning state of a context: database and memoized decisions.
+struct plasma_tuning_db_s {
+    plasma_tuning_entry_t *entries;
+    int num_entries;
+    int max_entries;
+    char *filename;        // file saved to after autotuning, or NULL
+    plasma_tuning_memo_t memo[PLASMA_TUNING_MEMO_SIZE];
+};
+
+/******************************************************************************/
+// Returns the size bucket of a problem, floor(log2(size)).
+static int plasma_tuning_bucket(int size)
+{
+    int bucket = 0;
+    while (size > 1) {
+        size >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+/******************************************************************************/
+static char plasma_tuning_precision_char(plasma_enum_t dtyp)
+{
+    switch (dtyp) {
+        case PlasmaRealFloat:     return 's';
+        case PlasmaRealDouble:    return 'd';
+        case PlasmaComplexFloat:  return 'c';
+        case PlasmaComplexDouble: return 'z';
+        default: return '?';
+    }
+}
+
+/******************************************************************************/
+static plasma_enum_t plasma_tuning_precision_enum(char c)
+{
+    switch (c) {
+        case 's': return PlasmaRealFloat;
+        case 'd': return PlasmaRealDouble;
+        case 'c': return PlasmaComplexFloat;
+        case 'z': return PlasmaComplexDouble;
+        default: return -1;
+    }
+}
+
+/******************************************************************************/
+// Returns the memo slot of a tuning decision, setting hit if it holds the
+// decision, or NULL if the context has no tuning state.
+static plasma_tuning_memo_t *plasma_tuning_memo(
+    plasma_context_t *plasma, plasma_enum_t dtyp, const char *func_name,
+    int num_threads, int count, const int *args, int *hit)
+{
+    *hit = 0;
+    if (plasma->tuning_db == NULL)
+        return NULL;
+
+    int buckets[PLASMA_TUNING_MAX_ARGS];
+    unsigned int hash = (unsigned int)(size_t)func_name;
+    hash = hash*31 + (unsigned int)dtyp;
+    hash = hash*31 + (unsigned int)num_threads;
+    for (int i = 0; i < count; i++) {
+        buckets[i] = plasma_tuning_bucket(args[i]);
+        hash = hash*31 + (unsigned int)buckets[i];
+    }
+    plasma_tuning_memo_t *memo =
+        &plasma->tuning_db->memo[hash % PLASMA_TUNING_MEMO_SIZE];
+
+    if (memo->func_name != NULL &&
+        memo->dtyp == dtyp &&
+        memo->num_threads == num_threads &&
+        memo->count == count &&
+        memcmp(memo->buckets, buckets, count*sizeof(int)) == 0 &&
+        strcmp(memo->func_name, func_name) == 0) {
+        *hit = 1;
+        return memo;
+    }
+
+    // Take the slot over for this decision.
+    memo->func_name = func_name;
+    memo->dtyp = dtyp;
+    memo->num_threads = num_threads;
+    memo->count = count;
+    memcpy(memo->buckets, buckets, count*sizeof(int));
+    memo->found = 0;
+    return memo;
+}
+
+/******************************************************************************/
+// Drops the memoized tuning decisions.
+static void plasma_tuning_memo_clear(plasma_context_t *plasma)
+{
+    if (plasma->tuning_db != NULL) {
+        for (int i = 0; i < PLASMA_TUNING_MEMO_SIZE; i++)
+            plasma->tuning_db->memo[i].func_name = NULL;
+    }
+}
+
+/******************************************************************************/
+// Returns the entry for routine, dtyp, num_threads and bucket, adding an
+// empty one if create is set, or NULL.
+static plasma_tuning_entry_t *plasma_tuning_entry(
+    struct plasma_tuning_db_s *db, const char *routine, plasma_enum_t dtyp,
+    int num_threads, int bucket, int create)
+{
+    for (int i = 0; i < db->num_entries; i++) {
+        plasma_tuning_entry_t *entry = &db->entries[i];
+        if (entry->dtyp == dtyp && entry->num_threads == num_threads &&
+            entry->bucket == bucket && strcmp(entry->routine, routine) == 0)
+            return entry;
+    }
+    if (! create)
+        return NULL;
+
+    if (db->num_entries == db->max_entries) {
+        int max_entries = db->max_entries == 0 ? 64 : 2*db->max_entries;
+        plasma_tuning_entry_t *entries = (plasma_tuning_entry_t*)realloc(
+            db->entries, max_entries*sizeof(plasma_tuning_entry_t));
+        if (entries == NULL) {
+            plasma_error("realloc() failed");
+            return NULL;
+        }
+        db->entries = entries;
+        db->max_entries = max_entries;
+    }
+    plasma_tuning_entry_t *entry = &db->entries[db->num_entries++];
+    memset(entry, 0, sizeof(plasma_tuning_entry_t));
+    strncpy(entry->routine, routine, sizeof(entry->routine)-1);
+    entry->dtyp = dtyp;
+    entry->num_threads = num_threads;
+    entry->bucket = bucket;
+    return entry;
+}
+
+/******************************************************************************/
+// Looks up the tuned value of func_name ("getrf_nb", "getrf_ib",
+// "getrf_max_panel_threads", "getrf_small", etc.) in the database, for the current number
+// of threads and the size bucket closest to the one of size.
+// Returns 1 and sets out if found.
+static int plasma_tuning_lookup(plasma_context_t *plasma, plasma_enum_t dtyp,
+                                const char *func_name, int size, int *out)
+{
+    struct plasma_tuning_db_s *db = plasma->tuning_db;
+    if (db == NULL || db->num_entries == 0)
+        return 0;
+
+    const char *param = strchr(func_name, '_');
+    if (param == NULL)
+        return 0;
+    size_t len = param - func_name;
+    param++;
+
+    int num_threads = omp_get_max_threads();
+    int bucket = plasma_tuning_bucket(size);
+    int value = 0;
+    int distance = -1;
+    for (int i = 0; i < db->num_entries; i++) {
+        plasma_tuning_entry_t *entry = &db->entries[i];
+        if (entry->dtyp != dtyp || entry->num_threads != num_threads ||
+            strlen(entry->routine) != len ||
+            strncmp(entry->routine, func_name, len) != 0)
+            continue;
+
+        int entry_value;
+        if (strcmp(param, "nb") == 0)
+            entry_value = entry->nb;
+        else if (strcmp(param, "ib") == 0)
+            entry_value = entry->ib;
+        else if (strcmp(param, "max_panel_threads") == 0)
+            entry_value = entry->max_panel_threads;
+        else if (strcmp(param, "small") == 0)
+            entry_value = entry->small;
+        else
+            continue;
+
+        int d = abs(entry->bucket - bucket);
+        if (entry_value != 0 && (distance < 0 || d < distance)) {
+            value = entry_value;
+            distance = d;
+        }
+    }
+    if (distance < 0)
+        return 0;
+
+    *out = value;
+    return 1;
+}
+
+/******************************************************************************/
+// Merges the entries of a tuning database file into the one of the context.
+static int plasma_tuning_db_load(plasma_context_t *plasma,
+                                 const char *filename)
+{
+    FILE *file = fopen(filename, "r");
+    if (file == NULL) {
+        plasma_error("cannot open tuning database");
+        return PlasmaErrorIllegalValue;
+    }
+
+    int retval = PlasmaSuccess;
+    char line[256];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char routine[16];
+        char precision;
+        int num_threads, bucket, nb, ib, max_panel_threads;
+        int small = 0;
+        if (line[0] == '#' || line[0] == '\n')
+            continue;
+        // Files written before the small column have 7 fields.
+        int num_fields = sscanf(line, "%15s %c %d %d %d %d %d %d",
+                                routine, &precision,
+                                &num_threads, &bucket, &nb, &ib,
+                                &max_panel_threads, &small);
+        if ((num_fields != 7 && num_fields != 8) ||
+            plasma_tuning_precision_enum(precision) == -1 ||
+            num_threads <= 0 || bucket < 0 ||
+            nb < 0 || ib < 0 || max_panel_threads < 0 || small < -1) {
+            plasma_error("invalid line in tuning database");
+            retval = PlasmaErrorIllegalValue;
+            continue;
+        }
+        plasma_tuning_entry_t *entry = plasma_tuning_entry(
+            plasma->tuning_db, routine,
+            plasma_tuning_precision_enum(precision),
+            num_threads, bucket, 1);
+        if (entry == NULL) {
+            retval = PlasmaErrorOutOfMemory;
+            break;
+        }
+        entry->nb = nb;
+        entry->ib = ib;
+        entry->max_panel_threads = max_panel_threads;
+        entry->small = small;
+    }
+    fclose(file);
+    plasma_tuning_memo_clear(plasma);
+
+    char *copy = strdup(filename);
+    if (copy != NULL) {
+        free(plasma->tuning_db->filename);
+        plasma->tuning_db->filename = copy;
+    }
+    return retval;
+}
+
+/******************************************************************************/
+static void plasma_tuning_db_init(plasma_context_t *plasma)
+{
+    plasma->tuning_db = (struct plasma_tuning_db_s*)calloc(
+        1, sizeof(struct plasma_tuning_db_s));
+    if (plasma->tuning_db == NULL) {
+        plasma_error("malloc() failed");
+        return;
+    }
+
+    // Load the tuning database, if any.
+    // A missing file is created by plasma_autotune().
+    char *db_filename = getenv("PLASMA_TUNING_DB");
+    if (db_filename != NULL) {
+        FILE *file = fopen(db_filename, "r");
+        if (file != NULL) {
+            fclose(file);
+            plasma_tuning_db_load(plasma, db_filename);
+        }
+        else {
+            plasma->tuning_db->filename = strdup(db_filename);
+        }
+    }
+}
+
+/******************************************************************************/
+static void plasma_tuning_db_finalize(plasma_context_t *plasma)
+{
+    struct plasma_tuning_db_s *db = plasma->tuning_db;
+    if (db != NULL) {
+        free(db->entries);
+        free(db->filename);
+        free(db);
+    }
+    plasma->tuning_db = NULL;
+}
+
+/******************************************************************************/
+// Returns nonzero if the plasma_tune_* functions have anything to look up.
+static int plasma_tuning_active(plasma_context_t *plasma)
+{
+    return plasma->L != NULL ||
+           (plasma->tuning_db != NULL && plasma->tuning_db->num_entries > 0);
+}
+
+/******************************************************************************/
+// Records tuned values, zero values being left unchanged.
+int plasma_tuning_record(plasma_context_t *plasma, const char *routine,
+                         plasma_enum_t dtyp, int num_threads, int size,
+                         int nb, int ib, int max_panel_threads, int small)
+{
+    struct plasma_tuning_db_s *db = plasma->tuning_db;
+    if (db == NULL)
+        return PlasmaErrorNotInitialized;
+
+    plasma_tuning_entry_t *entry = plasma_tuning_entry(
+        db, routine, dtyp, num_threads, plasma_tuning_bucket(size), 1);
+    if (entry == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    plasma_tuning_memo_clear(plasma);
+    if (nb > 0)
+        entry->nb = nb;
+    if (ib > 0)
+        entry->ib = ib;
+    if (max_panel_threads > 0)
+        entry->max_panel_threads = max_panel_threads;
+    if (small != 0)
+        entry->small = small;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Saves the database after autotuning, if it has a file.
+int plasma_tuning_autosave(plasma_context_t *plasma)
+{
+    struct plasma_tuning_db_s *db = plasma->tuning_db;
+    if (db == NULL || db->filename == NULL)
+        return PlasmaSuccess;
+
+    return plasma_tuning_save(db->filename);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_tuning
+    Loads a tuning database written by plasma_tuning_save() into the context
+    of the calling thread, merging it with the entries already there.
+    The file also becomes the one plasma_autotune() saves to.
+    The database given by the PLASMA_TUNING_DB environment variable is loaded
+    by plasma_init().
+
+    The file has one line per routine, precision, number of threads and size
+    bucket, floor(log2(size)), with the tuned values, 0 if not tuned.
+    The last one, which may be omitted, is the PlasmaSmallSize threshold,
+    -1 if the small problem path is never taken.
+
+        # routine precision threads bucket nb ib max_panel_threads small
+        getrf d 8 10 192 32 2 -1
+
+    Lines starting with # are ignored.
+*/
+int plasma_tuning_load(const char *filename)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (plasma->tuning_db == NULL)
+        return PlasmaErrorNotInitialized;
+    if (filename == NULL) {
+        plasma_error("NULL filename");
+        return PlasmaErrorNullParameter;
+    }
+    return plasma_tuning_db_load(plasma, filename);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_tuning
+    Saves the tuning database of the context of the calling thread.
+    If filename is NULL, saves to the file it was loaded from.
+*/
+int plasma_tuning_save(const char *filename)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    struct plasma_tuning_db_s *db = plasma->tuning_db;
+    if (db == NULL)
+        return PlasmaErrorNotInitialized;
+    if (filename == NULL)
+        filename = db->filename;
+    if (filename == NULL) {
+        plasma_error("no tuning database file");
+        return PlasmaErrorNullParameter;
+    }
+
+    FILE *file = fopen(filename, "w");
+    if (file == NULL) {
+        plasma_error("cannot write tuning database");
+        return PlasmaErrorIllegalValue;
+    }
+    fprintf(file,
+            "# routine precision threads bucket nb ib max_panel_threads "
+            "small\n");
+    for (int i = 0; i < db->num_entries; i++) {
+        plasma_tuning_entry_t *entry = &db->entries[i];
+        fprintf(file, "%s %c %d %d %d %d %d %d\n",
+                entry->routine, plasma_tuning_precision_char(entry->dtyp),
+                entry->num_threads, entry->bucket,
+                entry->nb, entry->ib, entry->max_panel_threads,
+                entry->small);
+    }
+    if (fclose(file) != 0) {
+        plasma_error("cannot write tuning database");
+        return PlasmaErrorIllegalValue;
+    }
+    return PlasmaSuccess;
+}
+
 #if defined(PLASMA_USE_LUA)
 #include <lua.h>
 #include <lauxlib.h>
 #include <lualib.h>
 
 /******************************************************************************/
-void
-plasma_tuning_init(plasma_context_t *plasma)
+// Creates the Lua state and executes the tuning file.
+static void plasma_tuning_lua_init(plasma_context_t *plasma)
 {
+    plasma->L = NULL;
+
     // Initiaize Lua.
     lua_State *L = luaL_newstate();
     if (L == NULL) {
@@ -62,100 +501,170 @@ plasma_tuning_init(plasma_context_t *plasma)
         lua_close(L);
         return;
     }
+    plasma->L = L;
 }
 
 /******************************************************************************/
-void plasma_tuning_finalize(plasma_context_t *plasma)
+static void plasma_tuning_lua_finalize(plasma_context_t *plasma)
 {
     lua_State *L = (lua_State *)plasma->L;
     if (L != NULL)
         lua_close(L);
+    plasma->L = NULL;
 }
 
 /******************************************************************************/
-static void plasma_tune(plasma_context_t *plasma, plasma_enum_t dtyp,
-                        const char *func_name, int *out, int count, ...)
+// Calls the Lua function func_name. Returns 1 and sets out on success.
+static int plasma_tuning_lua_call(plasma_context_t *plasma,
+                                  plasma_enum_t dtyp, const char *func_name,
+                                  int num_threads, int count, const int *args,
+                                  int *out)
 {
     lua_State *L = (lua_State *)plasma->L;
+    if (L == NULL)
+        return 0;
+
     int retval;
     retval = lua_getglobal(L, func_name);
     if (retval != LUA_TFUNCTION) {
         plasma_error("lua_getglobal() failed");
-        return;
+        lua_pop(L, 1);
+        return 0;
     }
     switch (dtyp) {
         case PlasmaComplexDouble: lua_pushstring(L, "Z"); break;
         case PlasmaComplexFloat:  lua_pushstring(L, "C"); break;
         case PlasmaRealDouble:    lua_pushstring(L, "D"); break;
         case PlasmaRealFloat:     lua_pushstring(L, "S"); break;
-        default: plasma_error("invalid type"); return;
+        default: plasma_error("invalid type"); lua_pop(L, 1); return 0;
     }
 
-    lua_pushinteger(L, omp_get_max_threads());
+    lua_pushinteger(L, num_threads);
 
-    va_list ap;
-    va_start(ap, count);
     for (int i = 0; i < count; i++)
-        lua_pushinteger(L, va_arg(ap, int));
-    va_end(ap);
+        lua_pushinteger(L, args[i]);
 
     retval = lua_pcall(L, 2+count, 1, 0);
     if (retval != LUA_OK) {
         plasma_error("lua_pcall() failed");
-        return;
+        lua_pop(L, 1);
+        return 0;
     }
     retval = lua_tonumber(L, -1);
+    lua_pop(L, 1);
     if (retval == 0) {
         plasma_error("lua_tonumber() failed");
-        return;
+        return 0;
     }
     *out = retval;
-    lua_pop(L, 1);
+    return 1;
 }
 
 #else
-void
-plasma_tuning_init(plasma_context_t *plasma)
+/******************************************************************************/
+static void plasma_tuning_lua_init(plasma_context_t *plasma)
 {
-    if (plasma) return;
+    plasma->L = NULL;
 }
 
-void plasma_tuning_finalize(plasma_context_t *plasma)
+static void plasma_tuning_lua_finalize(plasma_context_t *plasma)
 {
-    if (plasma) return;
+    plasma->L = NULL;
 }
 
+static int plasma_tuning_lua_call(plasma_context_t *plasma,
+                                  plasma_enum_t dtyp, const char *func_name,
+                                  int num_threads, int count, const int *args,
+                                  int *out)
+{
+    return 0;
+}
+#endif
 
+/******************************************************************************/
+void plasma_tuning_init(plasma_context_t *plasma)
+{
+    plasma_tuning_db_init(plasma);
+    plasma_tuning_lua_init(plasma);
+}
+
+/******************************************************************************/
+void plasma_tuning_finalize(plasma_context_t *plasma)
+{
+    plasma_tuning_lua_finalize(plasma);
+    plasma_tuning_db_finalize(plasma);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_tuning
+    Drops the memoized tuning decisions of the context of the calling thread
+    and executes the Lua tuning file (PLASMA_TUNING_FILENAME) again, if Lua
+    is used. To be called when the tuning file changes.
+    Changes to the tuning database through plasma_autotune() and
+    plasma_tuning_load() drop the memoized decisions by themselves.
+    This function must be called outside of any parallel region.
+*/
+int plasma_tuning_invalidate()
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (omp_in_parallel())
+        return PlasmaErrorEnvironment;
+
+    plasma_tuning_memo_clear(plasma);
+    plasma_tuning_lua_finalize(plasma);
+    plasma_tuning_lua_init(plasma);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Sets out to the tuned value of func_name ("getrf_nb", etc.), looked up in
+// the database first, then with the Lua function of that name.
+// Decisions are memoized per precision, number of threads and size buckets
+// of the arguments, so repeated calls bypass the lookups.
+// out is left unchanged if there is no tuned value.
 static void plasma_tune(plasma_context_t *plasma, plasma_enum_t dtyp,
                         const char *func_name, int *out, int count, ...)
 {
+    int args[PLASMA_TUNING_MAX_ARGS];
     va_list ap;
     va_start(ap, count);
-    /* drain variable arguments to prevent stack leaks */
     for (int i = 0; i < count; i++)
-        va_arg(ap, int);
+        args[i] = va_arg(ap, int);
     va_end(ap);
 
-    /* When Lua is missing use tile size 100 with inner blocking 50 and one
-     * panel thread. */
-    if (strstr(func_name, "_nb"))
-        *out = 100;
-    else if (strstr(func_name, "_ib"))
-        *out = 50;
-    else if (strstr(func_name, "_threads"))
-        *out = 1;
-    else {
-        plasma_error("plasma_tune() unknown routine");
-        *out = 64;
+    int num_threads = omp_get_max_threads();
+    int hit;
+    plasma_tuning_memo_t *memo = plasma_tuning_memo(
+        plasma, dtyp, func_name, num_threads, count, args, &hit);
+    if (hit) {
+        if (memo->found)
+            *out = memo->value;
+        return;
     }
+
+    int value = *out;
+    int size = count > 1 && args[1] > args[0] ? args[1] : args[0];
+    int found =
+        plasma_tuning_lookup(plasma, dtyp, func_name, size, &value) ||
+        plasma_tuning_lua_call(plasma, dtyp, func_name,
+                               num_threads, count, args, &value);
+    if (memo != NULL) {
+        memo->found = found;
+        memo->value = value;
+    }
+    if (found)
+        *out = value;
 }
-#endif
 
 /******************************************************************************/
 void plasma_tune_gbmm(plasma_context_t *plasma, plasma_enum_t dtyp,
                       int m, int n, int k, int kl, int ku)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "gbmm_nb", &plasma->nb, 5, m, n, k, kl, ku);
@@ -165,7 +674,7 @@ void plasma_tune_gbmm(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_gbtrf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n, int bw)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "gbtrf_nb", &plasma->nb, 2, n, bw);
@@ -178,7 +687,7 @@ void plasma_tune_gbtrf(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_geadd(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "geadd_nb", &plasma->nb, 2, m, n);
@@ -188,7 +697,7 @@ void plasma_tune_geadd(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_geinv(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "geinv_nb", &plasma->nb, 2, m, n);
@@ -201,7 +710,7 @@ void plasma_tune_geinv(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_gelqf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "gelqf_nb", &plasma->nb, 2, m, n);
@@ -212,17 +721,18 @@ void plasma_tune_gelqf(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_gemm(plasma_context_t *plasma, plasma_enum_t dtyp,
                       int m, int n, int k)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "gemm_nb", &plasma->nb, 3, m, n, k);
+    plasma_tune(plasma, dtyp, "gemm_small", &plasma->small_size, 3, m, n, k);
 }
 
 /******************************************************************************/
 void plasma_tune_geqrf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "geqrf_nb", &plasma->nb, 2, m, n);
@@ -233,7 +743,7 @@ void plasma_tune_geqrf(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_geswp(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "geswp_nb", &plasma->nb, 2, m, n);
@@ -243,20 +753,21 @@ void plasma_tune_geswp(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_getrf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "getrf_nb", &plasma->nb, 2, m, n);
     plasma_tune(plasma, dtyp, "getrf_ib", &plasma->ib, 2, m, n);
     plasma_tune(plasma, dtyp, "getrf_max_panel_threads",
                 &plasma->max_panel_threads, 2, m, n);
+    plasma_tune(plasma, dtyp, "getrf_small", &plasma->small_size, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_hetrf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "hetrf_nb", &plasma->nb, 1, n);
@@ -266,7 +777,7 @@ void plasma_tune_hetrf(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_lacpy(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "lacpy_nb", &plasma->nb, 2, m, n);
@@ -276,7 +787,7 @@ void plasma_tune_lacpy(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_lag2c(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "lag2c_nb", &plasma->nb, 2, m, n);
@@ -286,7 +797,7 @@ void plasma_tune_lag2c(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_lange(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "lange_nb", &plasma->nb, 2, m, n);
@@ -296,7 +807,7 @@ void plasma_tune_lange(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_lansy(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "lansy_nb", &plasma->nb, 1, n);
@@ -306,7 +817,7 @@ void plasma_tune_lansy(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_lantr(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "lantr_nb", &plasma->nb, 2, m, n);
@@ -316,7 +827,7 @@ void plasma_tune_lantr(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_lascl(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "lascl_nb", &plasma->nb, 2, m, n);
@@ -326,7 +837,7 @@ void plasma_tune_lascl(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_laset(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "laset_nb", &plasma->nb, 2, m, n);
@@ -336,7 +847,7 @@ void plasma_tune_laset(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_lauum(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "lauum_nb", &plasma->nb, 1, n);
@@ -346,7 +857,7 @@ void plasma_tune_lauum(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_pbtrf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "pbtrf_nb", &plasma->nb, 1, n);
@@ -356,7 +867,7 @@ void plasma_tune_pbtrf(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_poinv(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "poinv_nb", &plasma->nb, 1, n);
@@ -366,17 +877,18 @@ void plasma_tune_poinv(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_potrf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "potrf_nb", &plasma->nb, 1, n);
+    plasma_tune(plasma, dtyp, "potrf_small", &plasma->small_size, 1, n);
 }
 
 /******************************************************************************/
 void plasma_tune_symm(plasma_context_t *plasma, plasma_enum_t dtyp,
                       int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "symm_nb", &plasma->nb, 2, m, n);
@@ -386,7 +898,7 @@ void plasma_tune_symm(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_syr2k(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n, int k)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "syr2k_nb", &plasma->nb, 2, n, k);
@@ -396,7 +908,7 @@ void plasma_tune_syr2k(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_syrk(plasma_context_t *plasma, plasma_enum_t dtyp,
                       int n, int k)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "syrk_nb", &plasma->nb, 2, n, k);
@@ -406,7 +918,7 @@ void plasma_tune_syrk(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_tradd(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "tradd_nb", &plasma->nb, 2, m, n);
@@ -416,7 +928,7 @@ void plasma_tune_tradd(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_trmm(plasma_context_t *plasma, plasma_enum_t dtyp,
                       int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "trmm_nb", &plasma->nb, 2, m, n);
@@ -426,7 +938,7 @@ void plasma_tune_trmm(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_trsm(plasma_context_t *plasma, plasma_enum_t dtyp,
                       int m, int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "trsm_nb", &plasma->nb, 2, m, n);
@@ -436,7 +948,7 @@ void plasma_tune_trsm(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_trtri(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
-    if (NULL == plasma->L)
+    if (! plasma_tuning_active(plasma))
         return;
 
     plasma_tune(plasma, dtyp, "trtri_nb", &plasma->nb, 1, n);
@@ -8,37 +8,141 @@
  *
  **/
 #include "plasma_workspace.h"
+#include "plasma_context.h"
 #include "plasma_internal.h"
 
 #include <omp.h>
 
 /******************************************************************************/
-int plasma_workspace_create(plasma_workspace_t *workspace, size_t lworkspace,
-                            plasma_enum_t dtyp)
+void plasma_scratch_init(plasma_scratch_t *scratch)
 {
-    // Allocate array of pointers.
+    scratch->spaces = NULL;
+    scratch->size = 0;
+    scratch->nthread = 0;
+    scratch->busy = 0;
+}
+
+/******************************************************************************/
+void plasma_scratch_free(plasma_scratch_t *scratch, plasma_pool_t *pool)
+{
+    if (scratch->spaces != NULL) {
+        for (int i = 0; i < scratch->nthread; ++i)
+            plasma_pool_free(pool, scratch->spaces[i]);
+        free(scratch->spaces);
+    }
+    scratch->spaces = NULL;
+    scratch->size = 0;
+    scratch->nthread = 0;
+}
+
+/******************************************************************************/
+// Grows the scratch area to at least nthread buffers of at least size bytes.
+// Each thread allocates the buffers it will use, placing them close to it.
+// The caller has to hold the scratch area.
+static int plasma_scratch_grow(plasma_context_t *plasma, int nthread,
+                               size_t size)
+{
+    plasma_scratch_t *scratch = &plasma->scratch;
+    if (scratch->nthread >= nthread && scratch->size >= size)
+        return PlasmaSuccess;
+
+    // Never shrink.
+    if (nthread < scratch->nthread)
+        nthread = scratch->nthread;
+    if (size < scratch->size)
+        size = scratch->size;
+
+    plasma_scratch_free(scratch, &plasma->pool);
+    if ((scratch->spaces = (void**)calloc(nthread, sizeof(void*))) == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    scratch->nthread = nthread;
+
+    int info = PlasmaSuccess;
     #pragma omp parallel
-    #pragma omp master
     {
-        workspace->nthread = omp_get_num_threads();
+        int tid = omp_get_thread_num();
+        int nteam = omp_get_num_threads();
+        for (int i = tid; i < nthread; i += nteam) {
+            scratch->spaces[i] = plasma_pool_alloc(&plasma->pool, size);
+            if (scratch->spaces[i] == NULL)
+                info = PlasmaErrorOutOfMemory;
+        }
+    }
+    if (info != PlasmaSuccess) {
+        plasma_scratch_free(scratch, &plasma->pool);
+        return info;
     }
+    scratch->size = size;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Tries to take the scratch area of the context.
+// Returns 1 if taken, 0 if held by another workspace.
+static int plasma_scratch_trylock(plasma_context_t *plasma)
+{
+    int busy;
+    #pragma omp atomic capture
+    { busy = plasma->scratch.busy; plasma->scratch.busy = 1; }
+    return ! busy;
+}
+
+/******************************************************************************/
+static void plasma_scratch_unlock(plasma_context_t *plasma)
+{
+    #pragma omp atomic write
+    plasma->scratch.busy = 0;
+}
+
+/******************************************************************************/
+int plasma_workspace_create(plasma_workspace_t *workspace, size_t lworkspace,
+                            plasma_enum_t dtyp)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    // One buffer per thread of the parallel regions of the drivers.
+    workspace->nthread = omp_get_max_threads();
     workspace->lworkspace = lworkspace;
     workspace->dtyp  = dtyp;
+    workspace->persistent = 0;
+    size_t size = (size_t)lworkspace * plasma_element_size(workspace->dtyp);
+
+    // Draw the buffers from the scratch area of the context,
+    // unless another workspace holds it.
+    if (plasma_scratch_trylock(plasma)) {
+        if (plasma_scratch_grow(plasma, workspace->nthread,
+                                size) == PlasmaSuccess) {
+            workspace->spaces = plasma->scratch.spaces;
+            workspace->persistent = 1;
+            return PlasmaSuccess;
+        }
+        plasma_scratch_unlock(plasma);
+    }
+
+    // Allocate array of pointers.
     if ((workspace->spaces = (void**)calloc(workspace->nthread,
                                             sizeof(void*))) == NULL) {
-        free(workspace->spaces);
         plasma_error("malloc() failed");
         return PlasmaErrorOutOfMemory;
     }
 
-    // Each thread allocates its workspace.
-    size_t size = (size_t)lworkspace * plasma_element_size(workspace->dtyp);
+    // Each thread allocates its workspace,
+    // aligned and backed by huge pages as set for the context's pool.
     int info = PlasmaSuccess;
     #pragma omp parallel
     {
         int tid = omp_get_thread_num();
-        if ((workspace->spaces[tid] = (void*)malloc(size)) == NULL) {
-            info = PlasmaErrorOutOfMemory;
+        int nteam = omp_get_num_threads();
+        for (int i = tid; i < workspace->nthread; i += nteam) {
+            workspace->spaces[i] = plasma_pool_alloc(&plasma->pool, size);
+            if (workspace->spaces[i] == NULL) {
+                info = PlasmaErrorOutOfMemory;
+            }
         }
     }
     if (info != PlasmaSuccess) {
@@ -50,15 +154,78 @@ int plasma_workspace_create(plasma_workspace_t *workspace, size_t lworkspace,
 /******************************************************************************/
 int plasma_workspace_destroy(plasma_workspace_t *workspace)
 {
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
     if (workspace->spaces != NULL) {
-        for (int i = 0; i < workspace->nthread; ++i) {
-            free(workspace->spaces[i]);
-            workspace->spaces[i] = NULL;
+        if (workspace->persistent) {
+            // Hand the buffers back to the scratch area.
+            plasma_scratch_unlock(plasma);
+        }
+        else {
+            for (int i = 0; i < workspace->nthread; ++i) {
+                plasma_pool_free(&plasma->pool, workspace->spaces[i]);
+                workspace->spaces[i] = NULL;
+            }
+            free(workspace->spaces);
         }
-        free(workspace->spaces);
         workspace->spaces  = NULL;
         workspace->nthread = 0;
         workspace->lworkspace   = 0;
+        workspace->persistent = 0;
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_init
+    Pre-sizes the persistent per-thread workspaces of the context to at
+    least size bytes per thread, so that the drivers do not allocate
+    workspaces when first called. Typically called after plasma_init().
+    This function must be called outside of any parallel region.
+*/
+int plasma_workspace_reserve(size_t size)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (omp_in_parallel())
+        return PlasmaErrorEnvironment;
+
+    if (! plasma_scratch_trylock(plasma)) {
+        plasma_error("workspaces in use");
+        return PlasmaErrorEnvironment;
+    }
+    int retval = plasma_scratch_grow(plasma, omp_get_max_threads(), size);
+    plasma_scratch_unlock(plasma);
+    return retval;
+}
+
+/***************************************************************************//**
+    @ingroup plasma_init
+    Frees the persistent per-thread workspaces of the context.
+    They grow again as needed by later calls.
+    This function must be called outside of any parallel region.
+*/
+int plasma_workspace_release()
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (omp_in_parallel())
+        return PlasmaErrorEnvironment;
+
+    if (! plasma_scratch_trylock(plasma)) {
+        plasma_error("workspaces in use");
+        return PlasmaErrorEnvironment;
     }
+    plasma_scratch_free(&plasma->scratch, &plasma->pool);
+    plasma_scratch_unlock(plasma);
     return PlasmaSuccess;
 }
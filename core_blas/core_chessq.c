@@ -0,0 +1,74 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zhessq.c, normal z -> c, Sat Oct 17 13:39:46 2026
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <math.h>
+
+/******************************************************************************/
+__attribute__((weak))
+void plasma_core_chessq(plasma_enum_t uplo,
+                 int n,
+                 const plasma_complex32_t *A, int lda,
+                 float *scale, float *sumsq)
+{
+    int ione = 1;
+    if (uplo == PlasmaUpper) {
+        for (int j = 1; j < n; j++)
+            // TODO: Inline this operation.
+            LAPACK_classq(&j, &A[lda*j], &ione, scale, sumsq);
+    }
+    else { // PlasmaLower
+        for (int j = 0; j < n-1; j++) {
+            int len = n-j-1;
+            // TODO: Inline this operation.
+            LAPACK_classq(&len, &A[lda*j+j+1], &ione, scale, sumsq);
+        }
+    }
+    *sumsq *= 2.0;
+    for (int i = 0; i < n; i++) {
+        // diagonal is real, ignore imaginary part
+        if (creal(A[lda*i+i]) != 0.0) { // != propagates nan
+            float absa = fabsf(creal(A[lda*i+i]));
+            if (*scale < absa) {
+                *sumsq = 1.0 + *sumsq*((*scale/absa)*(*scale/absa));
+                *scale = absa;
+            }
+            else {
+                *sumsq = *sumsq + ((absa/(*scale))*(absa/(*scale)));
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+void plasma_core_omp_chessq(plasma_enum_t uplo,
+                     int n,
+                     const plasma_complex32_t *A, int lda,
+                     float *scale, float *sumsq,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:lda*n]) \
+                     depend(out:scale[0:n]) \
+                     depend(out:sumsq[0:n])
+    {
+        uint64_t start = plasma_trace_start();
+        if (sequence->status == PlasmaSuccess) {
+            *scale = 0.0;
+            *sumsq = 1.0;
+            plasma_core_chessq(uplo, n, A, lda, scale, sumsq);
+        }
+        plasma_trace_stop("chessq", A, n, n, start);
+    }
+}
@@ -0,0 +1,53 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlascl.c, normal z -> c, Sat Oct 17 13:39:48 2026
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+/******************************************************************************/
+__attribute__((weak))
+void plasma_core_clascl(plasma_enum_t uplo,
+                 float cfrom, float cto,
+                 int m, int n,
+                 plasma_complex32_t *A, int lda)
+{
+    // LAPACKE_clascl is not available in LAPACKE < 3.6.0
+    int kl;
+    int ku;
+    int info;
+    char type = lapack_const(uplo);
+    LAPACK_clascl(&type,
+                  &kl, &ku,
+                  &cfrom, &cto,
+                  &m, &n,
+                  A, &lda, &info);
+}
+
+/******************************************************************************/
+void plasma_core_omp_clascl(plasma_enum_t uplo,
+                     float cfrom, float cto,
+                     int m, int n,
+                     plasma_complex32_t *A, int lda,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:lda*n])
+    {
+        uint64_t start = plasma_trace_start();
+        if (sequence->status == PlasmaSuccess)
+            plasma_core_clascl(uplo,
+                        cfrom, cto,
+                        m, n,
+                        A, lda);
+        plasma_trace_stop("clascl", A, m, n, start);
+    }
+}
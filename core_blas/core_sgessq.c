@@ -0,0 +1,79 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgessq.c, normal z -> s, Sat Oct 17 13:39:44 2026
+ *
+ **/
+
+#include <math.h>
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+/******************************************************************************/
+__attribute__((weak))
+void plasma_core_sgessq(int m, int n,
+                 const float *A, int lda,
+                 float *scale, float *sumsq)
+{
+    int ione = 1;
+    for (int j = 0; j < n; j++) {
+        // TODO: Inline this operation.
+        LAPACK_slassq(&m, &A[j*lda], &ione, scale, sumsq);
+    }
+}
+
+/******************************************************************************/
+void plasma_core_omp_sgessq(int m, int n,
+                     const float *A, int lda,
+                     float *scale, float *sumsq,
+                     plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:lda*n]) \
+                     depend(out:scale[0:n]) \
+                     depend(out:sumsq[0:n])
+    {
+        uint64_t start = plasma_trace_start();
+        if (sequence->status == PlasmaSuccess) {
+            *scale = 0.0;
+            *sumsq = 1.0;
+            plasma_core_sgessq(m, n, A, lda, scale, sumsq);
+        }
+        plasma_trace_stop("sgessq", A, m, n, start);
+    }
+}
+
+/******************************************************************************/
+void plasma_core_omp_sgessq_aux(int n,
+                         const float *scale, const float *sumsq,
+                         float *value,
+                         plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    #pragma omp task depend(in:scale[0:n]) \
+                     depend(in:sumsq[0:n]) \
+                     depend(out:value[0:1])
+    {
+        uint64_t start = plasma_trace_start();
+        if (sequence->status == PlasmaSuccess) {
+            float scl = 0.0;
+            float sum = 1.0;
+            for (int i = 0; i < n; i++) {
+                if (scl < scale[i]) {
+                    sum = sumsq[i] + sum*((scl/scale[i])*(scl/scale[i]));
+                    scl = scale[i];
+                }
+                else if (scl > 0.) {
+                    sum = sum + sumsq[i]*(scale[i]/scl)*(scale[i]/scl);
+                }
+            }
+            *value = scl*sqrtf(sum);
+        }
+        plasma_trace_stop("sgessq_aux", value, n, 1, start);
+    }
+}
@@ -147,8 +147,10 @@ void plasma_core_omp_zgeadd(
     int k = (transa == PlasmaNoTrans) ? n : m;
 
     #pragma omp task depend(in:A[0:lda*k]) \
-                     depend(inout:B[0:ldb*n])
+                     depend(inout:B[0:ldb*n]) \
+                     affinity(B[0:ldb*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             int retval = plasma_core_zgeadd(transa,
                                      m, n,
@@ -159,5 +161,6 @@ void plasma_core_omp_zgeadd(
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        plasma_trace_stop("zgeadd", B, m, n, start);
     }
 }
@@ -179,6 +179,7 @@ void plasma_core_omp_zgelqt(int m, int n, int ib,
                      depend(out:T[0:ib*m]) // T should be mxib, but is stored
                                            // as ibxm
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
@@ -196,5 +197,6 @@ void plasma_core_omp_zgelqt(int m, int n, int ib,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        plasma_trace_stop("zgelqt", A, m, n, start);
     }
 }
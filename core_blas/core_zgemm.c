@@ -126,11 +126,13 @@ void plasma_core_omp_zgemm(
                      depend(in:B[0:ldb*bk]) \
                      depend(inout:C[0:ldc*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_zgemm(transa, transb,
                        m, n, k,
                        alpha, A, lda,
                               B, ldb,
                        beta,  C, ldc);
+        plasma_trace_stop("zgemm", C, m, n, start);
     }
 }
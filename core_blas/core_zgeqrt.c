@@ -178,6 +178,7 @@ void plasma_core_omp_zgeqrt(int m, int n, int ib,
     #pragma omp task depend(inout:A[0:lda*n]) \
                      depend(out:T[0:ib*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
@@ -195,5 +196,6 @@ void plasma_core_omp_zgeqrt(int m, int n, int ib,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        plasma_trace_stop("zgeqrt", A, m, n, start);
     }
 }
@@ -39,11 +39,13 @@ void plasma_core_omp_zgessq(int m, int n,
                      depend(out:scale[0:n]) \
                      depend(out:sumsq[0:n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             *scale = 0.0;
             *sumsq = 1.0;
             plasma_core_zgessq(m, n, A, lda, scale, sumsq);
         }
+        plasma_trace_stop("zgessq", A, m, n, start);
     }
 }
 
@@ -57,6 +59,7 @@ void plasma_core_omp_zgessq_aux(int n,
                      depend(in:sumsq[0:n]) \
                      depend(out:value[0:1])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             double scl = 0.0;
             double sum = 1.0;
@@ -71,5 +74,6 @@ void plasma_core_omp_zgessq_aux(int n,
             }
             *value = scl*sqrt(sum);
         }
+        plasma_trace_stop("zgessq_aux", value, n, 1, start);
     }
 }
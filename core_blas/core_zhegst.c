@@ -90,10 +90,12 @@ void plasma_core_omp_zhegst(int itype, plasma_enum_t uplo,
     #pragma omp task depend(inout:A[0:lda*n]) \
                      depend(in:B[0:ldb*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_zhegst(itype, uplo,
                         n,
                         A, lda,
                         B, ldb);
+        plasma_trace_stop("zhegst", A, n, n, start);
     }
 }
@@ -125,11 +125,13 @@ void plasma_core_omp_zher2k(
                      depend(in:B[0:ldb*bk]) \
                      depend(inout:C[0:ldc*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_zher2k(uplo, trans,
                         n, k,
                         alpha, A, lda,
                                B, ldb,
                         beta,  C, ldc);
+        plasma_trace_stop("zher2k", C, n, n, start);
     }
 }
@@ -99,10 +99,12 @@ void plasma_core_omp_zherk(plasma_enum_t uplo, plasma_enum_t trans,
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(inout:C[0:ldc*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_zherk(uplo, trans,
                        n, k,
                        alpha, A, lda,
                        beta,  C, ldc);
+        plasma_trace_stop("zherk", C, n, n, start);
     }
 }
@@ -63,10 +63,12 @@ void plasma_core_omp_zhessq(plasma_enum_t uplo,
                      depend(out:scale[0:n]) \
                      depend(out:sumsq[0:n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             *scale = 0.0;
             *sumsq = 1.0;
             plasma_core_zhessq(uplo, n, A, lda, scale, sumsq);
         }
+        plasma_trace_stop("zhessq", A, n, n, start);
     }
 }
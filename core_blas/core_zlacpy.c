@@ -118,12 +118,15 @@ void plasma_core_omp_zlacpy(plasma_enum_t uplo, plasma_enum_t transa,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(in:A[0:lda*n]) \
-                     depend(out:B[0:ldb*n])
+                     depend(out:B[0:ldb*n]) \
+                     affinity(B[0:ldb*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_zlacpy(uplo, transa,
                         m, n,
                         A, lda,
                         B, ldb);
+        plasma_trace_stop("zlacpy", B, m, n, start);
     }
 }
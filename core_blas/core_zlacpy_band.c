@@ -120,10 +120,14 @@ void plasma_core_omp_zlacpy_lapack2tile_band(plasma_enum_t uplo,
 {
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:B[0:ldb*n])
-    plasma_core_zlacpy_lapack2tile_band(uplo,
-                                 it, jt, m, n, nb, kl, ku,
-                                 A, lda,
-                                 B, ldb);
+    {
+        uint64_t start = plasma_trace_start();
+        plasma_core_zlacpy_lapack2tile_band(uplo,
+                                     it, jt, m, n, nb, kl, ku,
+                                     A, lda,
+                                     B, ldb);
+        plasma_trace_stop("zlacpy_lapack2tile_band", B, m, n, start);
+    }
 }
 
 /*******************************************************************************
@@ -217,8 +221,12 @@ void plasma_core_omp_zlacpy_tile2lapack_band(plasma_enum_t uplo,
 {
     #pragma omp task depend(in:B[0:ldb*n]) \
                      depend(out:A[0:lda*n])
-    plasma_core_zlacpy_tile2lapack_band(uplo,
-                                 it, jt, m, n, nb, kl, ku,
-                                 B, ldb,
-                                 A, lda);
+    {
+        uint64_t start = plasma_trace_start();
+        plasma_core_zlacpy_tile2lapack_band(uplo,
+                                     it, jt, m, n, nb, kl, ku,
+                                     B, ldb,
+                                     A, lda);
+        plasma_trace_stop("zlacpy_tile2lapack_band", A, m, n, start);
+    }
 }
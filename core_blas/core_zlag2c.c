@@ -64,6 +64,7 @@ void plasma_core_omp_zlag2c(int m, int n,
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:As[0:ldas*n])
     {
+        uint64_t start = plasma_trace_start();
         int info;
         if (sequence->status == PlasmaSuccess) {
             info = plasma_core_zlag2c(m, n, A, lda, As, ldas);
@@ -75,5 +76,6 @@ void plasma_core_omp_zlag2c(int m, int n,
                 }
             }
         }
+        plasma_trace_stop("zlag2c", As, m, n, start);
     }
 }
@@ -12,6 +12,7 @@
 
 #include <plasma_core_blas.h>
 #include "plasma_types.h"
+#include "plasma_internal.h"
 #include "core_lapack.h"
 
 #include <math.h>
@@ -68,10 +69,13 @@ void plasma_core_omp_zlange(plasma_enum_t norm, int m, int n,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(in:A[0:lda*n]) \
-                     depend(out:value[0:1])
+                     depend(out:value[0:1]) \
+                     affinity(A[0:lda*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_zlange(norm, m, n, A, lda, work, value);
+        plasma_trace_stop("zlange", A, m, n, start);
     }
 }
 
@@ -84,8 +88,10 @@ void plasma_core_omp_zlange_aux(plasma_enum_t norm, int m, int n,
     switch (norm) {
     case PlasmaOneNorm:
         #pragma omp task depend(in:A[0:lda*n]) \
-                         depend(out:value[0:n])
+                         depend(out:value[0:n]) \
+                         affinity(A[0:lda*n])
         {
+            uint64_t start = plasma_trace_start();
             if (sequence->status == PlasmaSuccess) {
                 for (int j = 0; j < n; j++) {
                     value[j] = cabs(A[lda*j]);
@@ -94,12 +100,15 @@ void plasma_core_omp_zlange_aux(plasma_enum_t norm, int m, int n,
                     }
                 }
             }
+            plasma_trace_stop("zlange_aux", A, m, n, start);
         }
         break;
     case PlasmaInfNorm:
         #pragma omp task depend(in:A[0:lda*n]) \
-                         depend(out:value[0:m])
+                         depend(out:value[0:m]) \
+                         affinity(A[0:lda*n])
         {
+            uint64_t start = plasma_trace_start();
             if (sequence->status == PlasmaSuccess) {
                 for (int i = 0; i < m; i++)
                     value[i] = 0.0;
@@ -110,6 +119,7 @@ void plasma_core_omp_zlange_aux(plasma_enum_t norm, int m, int n,
                     }
                 }
             }
+            plasma_trace_stop("zlange_aux", A, m, n, start);
         }
         break;
     }
@@ -39,8 +39,10 @@ void plasma_core_omp_zlansy(plasma_enum_t norm, plasma_enum_t uplo,
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:value[0:1])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_zlansy(norm, uplo, n, A, lda, work, value);
+        plasma_trace_stop("zlansy", A, n, n, start);
     }
 }
 
@@ -57,6 +59,7 @@ void plasma_core_omp_zlansy_aux(plasma_enum_t norm, plasma_enum_t uplo,
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:value[0:n])
         {
+            uint64_t start = plasma_trace_start();
             if (sequence->status == PlasmaSuccess) {
                 if (uplo == PlasmaUpper) {
                     for (int i = 0; i < n; i++)
@@ -83,6 +86,7 @@ void plasma_core_omp_zlansy_aux(plasma_enum_t norm, plasma_enum_t uplo,
                     }
                 }
             }
+            plasma_trace_stop("zlansy_aux", A, n, n, start);
         }
         break;
     }
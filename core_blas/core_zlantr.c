@@ -47,8 +47,10 @@ void plasma_core_omp_zlantr(plasma_enum_t norm, plasma_enum_t uplo, plasma_enum_
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:value[0:1])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_zlantr(norm, uplo, diag, m, n, A, lda, work, value);
+        plasma_trace_stop("zlantr", A, m, n, start);
     }
 }
 
@@ -65,6 +67,7 @@ void plasma_core_omp_zlantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:value[0:n])
         {
+            uint64_t start = plasma_trace_start();
             if (sequence->status == PlasmaSuccess) {
                 if (uplo == PlasmaUpper) {
                     if (diag == PlasmaNonUnit) {
@@ -116,12 +119,14 @@ void plasma_core_omp_zlantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                     }
                 }
             }
+            plasma_trace_stop("zlantr_aux", A, m, n, start);
         }
         break;
     case PlasmaInfNorm:
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:value[0:m])
         {
+            uint64_t start = plasma_trace_start();
             if (sequence->status == PlasmaSuccess) {
                 if (uplo == PlasmaUpper) {
                     if (diag == PlasmaNonUnit) {
@@ -182,6 +187,7 @@ void plasma_core_omp_zlantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                     }
                 }
             }
+            plasma_trace_stop("zlantr_aux", A, m, n, start);
         }
         break;
     }
@@ -42,10 +42,12 @@ void plasma_core_omp_zlascl(plasma_enum_t uplo,
 {
     #pragma omp task depend(inout:A[0:lda*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_zlascl(uplo,
                         cfrom, cto,
                         m, n,
                         A, lda);
+        plasma_trace_stop("zlascl", A, m, n, start);
     }
 }
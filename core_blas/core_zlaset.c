@@ -78,7 +78,11 @@ void plasma_core_omp_zlaset(plasma_enum_t uplo,
                      plasma_complex64_t *A)
 {
     #pragma omp task depend(out:A[0:mb*nb])
-    plasma_core_zlaset(uplo, m, n,
-                alpha, beta,
-                A+i+j*mb, mb);
+    {
+        uint64_t start = plasma_trace_start();
+        plasma_core_zlaset(uplo, m, n,
+                    alpha, beta,
+                    A+i+j*mb, mb);
+        plasma_trace_stop("zlaset", A+i+j*mb, m, n, start);
+    }
 }
@@ -71,6 +71,7 @@ void plasma_core_omp_zlauum(plasma_enum_t uplo,
 {
     #pragma omp task depend(inout:A[0:lda*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             int info = plasma_core_zlauum(uplo, n, A, lda);
             if (info != PlasmaSuccess) {
@@ -78,5 +79,6 @@ void plasma_core_omp_zlauum(plasma_enum_t uplo,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        plasma_trace_stop("zlauum", A, n, n, start);
     }
 }
@@ -71,6 +71,7 @@ void plasma_core_omp_zpotrf(plasma_enum_t uplo,
 {
     #pragma omp task depend(inout:A[0:lda*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             int info = plasma_core_zpotrf(uplo,
                                    n,
@@ -78,5 +79,6 @@ void plasma_core_omp_zpotrf(plasma_enum_t uplo,
             if (info != 0)
                 plasma_request_fail(sequence, request, iinfo+info);
         }
+        plasma_trace_stop("zpotrf", A, n, n, start);
     }
 }
@@ -111,11 +111,13 @@ void plasma_core_omp_zsymm(
                      depend(in:B[0:ldb*n]) \
                      depend(inout:C[0:ldc*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_zsymm(side, uplo,
                        m, n,
                        alpha, A, lda,
                               B, ldb,
                        beta,  C, ldc);
+        plasma_trace_stop("zsymm", C, m, n, start);
     }
 }
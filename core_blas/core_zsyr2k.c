@@ -121,11 +121,13 @@ void plasma_core_omp_zsyr2k(
                      depend(in:B[0:ldb*bk]) \
                      depend(inout:C[0:ldc*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_zsyr2k(uplo, trans,
                         n, k,
                         alpha, A, lda,
                                B, ldb,
                         beta,  C, ldc);
+        plasma_trace_stop("zsyr2k", C, n, n, start);
     }
 }
@@ -100,10 +100,12 @@ void plasma_core_omp_zsyrk(
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(inout:C[0:ldc*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_zsyrk(uplo, trans,
                        n, k,
                        alpha, A, lda,
                        beta,  C, ldc);
+        plasma_trace_stop("zsyrk", C, n, n, start);
     }
 }
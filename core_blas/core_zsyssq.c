@@ -63,11 +63,13 @@ void plasma_core_omp_zsyssq(plasma_enum_t uplo,
                      depend(out:scale[0:n]) \
                      depend(out:sumsq[0:n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             *scale = 0.0;
             *sumsq = 1.0;
             plasma_core_zsyssq(uplo, n, A, lda, scale, sumsq);
         }
+        plasma_trace_stop("zsyssq", A, n, n, start);
     }
 }
 
@@ -81,6 +83,7 @@ void plasma_core_omp_zsyssq_aux(int m, int n,
                      depend(in:sumsq[0:n]) \
                      depend(out:value[0:1])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             double scl = 0.0;
             double sum = 1.0;
@@ -111,5 +114,6 @@ void plasma_core_omp_zsyssq_aux(int m, int n,
             }
             *value = scl*sqrt(sum);
         }
+        plasma_trace_stop("zsyssq_aux", value, m, n, start);
     }
 }
@@ -195,6 +195,7 @@ void plasma_core_omp_ztradd(
     #pragma omp task depend(in:A[0:lda*k]) \
                      depend(inout:B[0:ldb*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             int retval = plasma_core_ztradd(uplo, transa,
                                      m, n,
@@ -205,5 +206,6 @@ void plasma_core_omp_ztradd(
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        plasma_trace_stop("ztradd", B, m, n, start);
     }
 }
@@ -123,11 +123,13 @@ void plasma_core_omp_ztrmm(
     #pragma omp task depend(in:A[0:lda*k]) \
                      depend(inout:B[0:ldb*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_ztrmm(side, uplo,
                        transa, diag,
                        m, n,
                        alpha, A, lda,
                               B, ldb);
+        plasma_trace_stop("ztrmm", B, m, n, start);
     }
 }
@@ -117,11 +117,13 @@ void plasma_core_omp_ztrsm(
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(inout:B[0:ldb*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess)
             plasma_core_ztrsm(side, uplo,
                        transa, diag,
                        m, n,
                        alpha, A, lda,
                               B, ldb);
+        plasma_trace_stop("ztrsm", B, m, n, start);
     }
 }
@@ -97,10 +97,12 @@ void plasma_core_omp_ztrssq(plasma_enum_t uplo, plasma_enum_t diag,
                      depend(out:scale[0:n]) \
                      depend(out:sumsq[0:n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             *scale = 0.0;
             *sumsq = 1.0;
             plasma_core_ztrssq(uplo, diag, m, n, A, lda, scale, sumsq);
         }
+        plasma_trace_stop("ztrssq", A, m, n, start);
     }
 }
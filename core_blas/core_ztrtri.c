@@ -74,11 +74,13 @@ void plasma_core_omp_ztrtri(plasma_enum_t uplo, plasma_enum_t diag,
 {
     #pragma omp task depend(inout:A[0:lda*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             int info = plasma_core_ztrtri(uplo, diag,
                                    n, A, lda);
             if (info != 0)
                 plasma_request_fail(sequence, request, iinfo+info);
         }
+        plasma_trace_stop("ztrtri", A, n, n, start);
     }
 }
@@ -266,6 +266,7 @@ void plasma_core_omp_ztsmlq(plasma_enum_t side, plasma_enum_t trans,
                      depend(in:V[0:ldv*n2]) \
                      depend(in:T[0:ib*k])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
@@ -286,5 +287,6 @@ void plasma_core_omp_ztsmlq(plasma_enum_t side, plasma_enum_t trans,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        plasma_trace_stop("ztsmlq", A2, m2, n2, start);
     }
 }
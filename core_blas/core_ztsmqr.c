@@ -262,6 +262,7 @@ void plasma_core_omp_ztsmqr(plasma_enum_t side, plasma_enum_t trans,
                      depend(in:V[0:ldv*k]) \
                      depend(in:T[0:ib*k])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
@@ -282,5 +283,6 @@ void plasma_core_omp_ztsmqr(plasma_enum_t side, plasma_enum_t trans,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        plasma_trace_stop("ztsmqr", A2, m2, n2, start);
     }
 }
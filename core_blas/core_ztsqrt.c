@@ -221,6 +221,7 @@ void plasma_core_omp_ztsqrt(int m, int n, int ib,
                      depend(inout:A2[0:lda2*n]) \
                      depend(out:T[0:ib*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
@@ -239,5 +240,6 @@ void plasma_core_omp_ztsqrt(int m, int n, int ib,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        plasma_trace_stop("ztsqrt", A2, m, n, start);
     }
 }
@@ -269,6 +269,7 @@ void plasma_core_omp_zttmqr(plasma_enum_t side, plasma_enum_t trans,
                      depend(in:V[0:ldv*k]) \
                      depend(in:T[0:ib*k])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
@@ -289,5 +290,6 @@ void plasma_core_omp_zttmqr(plasma_enum_t side, plasma_enum_t trans,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        plasma_trace_stop("zttmqr", A2, m2, n2, start);
     }
 }
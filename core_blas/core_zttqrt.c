@@ -247,6 +247,7 @@ void plasma_core_omp_zttqrt(int m, int n, int ib,
                      depend(inout:A2[0:lda2*n]) \
                      depend(out:T[0:ib*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
@@ -265,5 +266,6 @@ void plasma_core_omp_zttqrt(int m, int n, int ib,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        plasma_trace_stop("zttqrt", A2, m, n, start);
     }
 }
@@ -245,6 +245,7 @@ void plasma_core_omp_zunmqr(plasma_enum_t side, plasma_enum_t trans,
                      depend(in:T[0:ib*k]) \
                      depend(inout:C[0:ldc*n])
     {
+        uint64_t start = plasma_trace_start();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
             int tid = omp_get_thread_num();
@@ -264,5 +265,6 @@ void plasma_core_omp_zunmqr(plasma_enum_t side, plasma_enum_t trans,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        plasma_trace_stop("zunmqr", C, m, n, start);
     }
 }
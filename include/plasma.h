@@ -13,6 +13,11 @@
 #include "plasma_async.h"
 #include "plasma_descriptor.h"
 #include "plasma_context.h"
+#include "plasma_dag.h"
+#include "plasma_future.h"
+#include "plasma_handle.h"
+#include "plasma_stats.h"
+#include "plasma_trace.h"
 #include "plasma_tuning.h"
 #include "plasma_workspace.h"
 
@@ -10,18 +10,33 @@
 #ifndef PLASMA_BARRIER_H
 #define PLASMA_BARRIER_H
 
+#include "plasma_types.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-/******************************************************************************/
+/***************************************************************************//**
+ * Barrier of the threads of multithreaded tasks, e.g., panel factorizations.
+ *
+ * Centralized barrier counting the threads arriving, released by the last
+ * one by advancing the generation the others wait on. The waiting depends
+ * on the mode (PlasmaBarrierMode):
+ * - PlasmaBarrierSpin spins on the generation,
+ * - PlasmaBarrierBackoff spins with an exponential backoff, reducing the
+ *   traffic on the cache line of the barrier,
+ * - PlasmaBarrierBlocking spins with backoff for a while, then sleeps
+ *   (futex on Linux, yields elsewhere), releasing the core to preempted
+ *   or oversubscribed threads.
+ **/
 typedef struct {
-    int count;
-    volatile int passed;
+    int count;           ///< number of threads arrived
+    volatile int passed; ///< generation, advanced when all threads arrived
+    plasma_enum_t mode;  ///< PlasmaBarrierMode
 } plasma_barrier_t;
 
 /******************************************************************************/
-void plasma_barrier_init(plasma_barrier_t *barrier);
+void plasma_barrier_init(plasma_barrier_t *barrier, plasma_enum_t mode);
 void plasma_barrier_wait(plasma_barrier_t *barrier, int size);
 
 #ifdef __cplusplus
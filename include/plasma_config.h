@@ -0,0 +1,15 @@
+/* PLASMA configuration options */
+
+/* #undef PLASMA_CBLAS_ADD_TYPEDEF */
+
+/* #undef PLASMA_HAVE_MKL */
+
+/* #undef PLASMA_HAVE_ESSL */
+
+/* #undef PLASMA_WITH_ESSL */
+
+/* #undef PLASMA_WITH_MKL */
+
+/* #undef PLASMA_WITH_NETLIB */
+
+/* #undef PLASMA_USE_LUA */
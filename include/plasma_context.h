@@ -12,6 +12,10 @@
 
 #include "plasma_types.h"
 #include "plasma_barrier.h"
+#include "plasma_dag.h"
+#include "plasma_future.h"
+#include "plasma_pool.h"
+#include "plasma_workspace.h"
 
 #include <pthread.h>
 #if defined(PLASMA_USE_LUA)
@@ -29,14 +33,29 @@ extern "C" {
 /******************************************************************************/
 typedef struct {
     lua_State *L;                   ///< Lua state
+    struct plasma_tuning_db_s *tuning_db; ///< tuned nb, ib, etc.
     int tuning;                     ///< PlasmaEnabled or PlasmaDisabled
     int nb;                         ///< PlasmaNb
     int ib;                         ///< PlasmaIb
     plasma_enum_t inplace_outplace; ///< PlasmaInplaceOutplace
-    int max_threads;                ///< the value of OMP_NUM_THREADS
+    int max_threads;                ///< PlasmaNumThreads
     int max_panel_threads;          ///< max threads for panel factorization
     plasma_barrier_t barrier;       ///< thread barrier for multithreaded tasks
+    plasma_enum_t barrier_mode;     ///< PlasmaBarrierMode
     plasma_enum_t householder_mode; ///< PlasmaHouseholderMode
+    plasma_enum_t householder_tree; ///< PlasmaHouseholderTree
+    plasma_pool_t pool;             ///< pool of descriptor tile storage
+    plasma_enum_t numa_policy;      ///< PlasmaNumaPolicy
+    int tile_padding;               ///< PlasmaTilePadding in bytes
+    plasma_scratch_t scratch;       ///< persistent per-thread workspaces
+    struct plasma_executor_s *executor; ///< runs the asynchronous drivers
+    int task_replay;                ///< PlasmaTaskReplay
+    plasma_dag_t *dags;             ///< task graphs recorded for replay
+    plasma_enum_t scheduling;       ///< PlasmaScheduling
+    int lookahead;                  ///< PlasmaLookahead, panels prioritized
+    int small_size;                 ///< PlasmaSmallSize, 0 for nb, -1 off
+    int small_threads;              ///< PlasmaSmallNumThreads
+    int dry_run;                    ///< PlasmaDryRun
     int ss_ld;                  // static scheduler progress table leading dimension
     volatile int ss_abort;      // static scheduler abort flag
     volatile int *ss_progress;  // static scheduler progress table
@@ -59,6 +78,18 @@ plasma_context_t *plasma_context_self();
 void plasma_context_init(plasma_context_t *context);
 void plasma_context_finalize(plasma_context_t *context);
 
+/******************************************************************************/
+// Whether a problem of the given size takes the small problem path of the
+// drivers, running the LAPACK layout kernel without descriptors:
+// up to PlasmaSmallSize, or one tile if it is 0, never if it is -1.
+static inline int plasma_context_small(const plasma_context_t *plasma,
+                                       int size)
+{
+    int small_size = plasma->small_size == 0 ? plasma->nb
+                                             : plasma->small_size;
+    return size <= small_size;
+}
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
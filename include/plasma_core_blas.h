@@ -10,6 +10,8 @@
 #ifndef PLASMA_CORE_BLAS_H
 #define PLASMA_CORE_BLAS_H
 
+#include "plasma_trace.h"
+
 #include <stdio.h>
 
 #ifdef __cplusplus
@@ -0,0 +1,107 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_DAG_H
+#define PLASMA_DAG_H
+
+#include "plasma_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+// Routines whose task graphs are recorded.
+enum {
+    PlasmaDagPotrf,
+    PlasmaDagGetrf,
+    PlasmaDagGeqrf
+};
+
+// Access modes of the tiles.
+enum {
+    PlasmaDagIn,
+    PlasmaDagInout
+};
+
+/***************************************************************************//**
+ * Task of a recorded graph. The kernel and the tile indices are interpreted
+ * by the routine, so the graph is replayed on any matrix of the same shape.
+ **/
+typedef struct {
+    int kernel;   ///< routine specific kernel
+    int k, m, n;  ///< step and tile indices
+} plasma_dag_task_t;
+
+/***************************************************************************//**
+ * Description of a task of a dry run, used to estimate its cost.
+ **/
+typedef struct {
+    const char *name;  ///< kernel, e.g., "dgemm"
+    double flops;      ///< floating point operations
+    int priority;      ///< priority of its OpenMP task
+    int threads;       ///< number of threads running it
+} plasma_dag_info_t;
+
+/***************************************************************************//**
+ * Task graph recorded for one routine, variant and tile count.
+ * Dependencies are kept as successor lists with predecessor counts.
+ **/
+typedef struct plasma_dag_s {
+    int routine;          ///< PlasmaDagPotrf, etc.
+    int variant;          ///< PlasmaLower, etc.
+    int mt;               ///< number of tile rows
+    int nt;               ///< number of tile columns
+    int status;           ///< first error while recording
+    int num_tasks;
+    int max_tasks;
+    plasma_dag_task_t *tasks;
+    int *num_deps;        ///< number of predecessors of each task
+    int *succ_ptr;        ///< offsets of the successors of each task in succ
+    int *succ;
+    int num_edges;
+    int max_edges;
+    int *edges;           ///< (predecessor, successor) pairs while recording
+    int *last_writer;     ///< last task writing each tile while recording
+    int *readers;         ///< first reader since the last write, per tile
+    int *next_reader;     ///< next reader of the same tile, per access
+    int *reader_task;     ///< task of each reader access
+    int num_readers;
+    int max_readers;
+    const char *name;     ///< routine of a dry run, e.g., "dgetrf"
+    int m, n, nb, ib;     ///< matrix and tile sizes of a dry run
+    plasma_dag_info_t *info; ///< description of each task of a dry run
+    struct plasma_dag_s *next; ///< next graph recorded in the context
+} plasma_dag_t;
+
+/******************************************************************************/
+plasma_dag_t *plasma_dag_find(int routine, int variant, int mt, int nt);
+plasma_dag_t *plasma_dag_create(int routine, int variant, int mt, int nt);
+int plasma_dag_task(plasma_dag_t *dag, int kernel, int k, int m, int n);
+int plasma_dag_access(plasma_dag_t *dag, int m, int n, int mode);
+int plasma_dag_build(plasma_dag_t *dag);
+int plasma_dag_finish(plasma_dag_t *dag);
+int plasma_dag_dryrun(plasma_dag_t *dag, const char *name,
+                      int m, int n, int nb, int ib,
+                      void (*describe)(const plasma_dag_task_t *task,
+                                       void *arg, plasma_dag_info_t *info),
+                      void *arg);
+int plasma_dag_write(const char *filename);
+void plasma_dag_clear();
+void plasma_dag_replay(plasma_dag_t *dag,
+                       void (*run)(const plasma_dag_task_t *task, void *arg),
+                       void *arg);
+void plasma_dag_destroy(plasma_dag_t *dag);
+void plasma_dag_free_all(plasma_dag_t **dags);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_DAG_H
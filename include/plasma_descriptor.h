@@ -36,6 +36,9 @@ extern "C" {
  *     m2  |    A21   |A22|
  *         +----------+---+
  *
+ * The tiles of general matrices can be followed by pad elements
+ * (PlasmaTilePadding), to keep the tile stride off powers of two.
+ *
  **/
 typedef struct {
     // matrix properties
@@ -48,6 +51,9 @@ typedef struct {
     size_t A21;   ///< pointer to the beginning of A21
     size_t A12;   ///< pointer to the beginning of A12
     size_t A22;   ///< pointer to the beginning of A22
+    int inplace;  ///< matrix aliases the user's column-major matrix
+    int pooled;   ///< matrix was allocated from the context's pool
+    int pad;      ///< number of pad elements following each tile
 
     // tile parameters
     int mb; ///< number of rows in a tile
@@ -102,18 +108,26 @@ static inline void *plasma_tile_addr_general(plasma_desc_t A, int m, int n)
 
     if (mm < lm1)
         if (nn < ln1)
-            offset = A.mb*A.nb*(mm + (size_t)lm1 * nn);
+            offset = ((size_t)A.mb*A.nb + A.pad)*(mm + (size_t)lm1 * nn);
         else
-            offset = A.A12 + ((size_t)A.mb * (A.gn%A.nb) * mm);
+            offset = A.A12 + ((size_t)A.mb * (A.gn%A.nb) + A.pad) * mm;
     else
         if (nn < ln1)
-            offset = A.A21 + ((size_t)A.nb * (A.gm%A.mb) * nn);
+            offset = A.A21 + ((size_t)A.nb * (A.gm%A.mb) + A.pad) * nn;
         else
             offset = A.A22;
 
     return (void*)((char*)A.matrix + (offset*eltsize));
 }
 
+/******************************************************************************/
+// Returns the number of elements of the storage of a general
+// or general band matrix, including the padding of the tiles.
+static inline size_t plasma_desc_size(plasma_desc_t A)
+{
+    return A.A22 + (size_t)(A.gm%A.mb) * (A.gn%A.nb);
+}
+
 /******************************************************************************/
 static inline void *plasma_tile_addr_triangle(plasma_desc_t A, int m, int n)
 {
@@ -259,6 +273,10 @@ int plasma_desc_triangular_create(plasma_enum_t dtyp, plasma_enum_t uplo, int mb
                                   int lm, int ln, int i, int j, int m, int n,
                                   plasma_desc_t *A);
 
+int plasma_desc_general_inplace_create(plasma_enum_t dtyp, void *pA, int lda,
+                                       int mb, int nb, int m, int n,
+                                       plasma_desc_t *A);
+
 int plasma_desc_destroy(plasma_desc_t *A);
 
 int plasma_desc_general_init(plasma_enum_t precision, void *matrix,
@@ -0,0 +1,76 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_FUTURE_H
+#define PLASMA_FUTURE_H
+
+#include "plasma_types.h"
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+// Number of context settings carried by a future.
+#define PLASMA_FUTURE_NUM_SETTINGS 21
+
+/***************************************************************************//**
+ * @ingroup plasma_future
+ *
+ * Completion callback of an asynchronous driver.
+ * Called on the PLASMA thread running the driver, with the status the
+ * synchronous driver would have returned, before the future completes.
+ * It must not wait on its own future.
+ **/
+typedef void (*plasma_callback_t)(int status, void *data);
+
+/***************************************************************************//**
+ * @ingroup plasma_future
+ *
+ * Future of an asynchronous driver call, such as plasma_zgesv_async().
+ * Queued to the executor of the calling thread's context, which runs the
+ * drivers in submission order on its own thread and OpenMP team, with
+ * the settings the context had at submission.
+ *
+ * The fields are not meant to be accessed directly.
+ **/
+typedef struct plasma_future_s {
+    pthread_mutex_t mutex;      ///< protects done and status
+    pthread_cond_t cond;        ///< signaled on completion
+    int done;                   ///< nonzero once the driver has returned
+    int status;                 ///< return value of the driver
+    int (*run)(void *args);     ///< calls the driver
+    void *args;                 ///< arguments of run, freed after the call
+    plasma_callback_t callback; ///< called on completion, may be NULL
+    void *data;                 ///< passed to callback
+    int settings[PLASMA_FUTURE_NUM_SETTINGS]; ///< settings at submission
+    struct plasma_future_s *next; ///< next future in the executor's queue
+} plasma_future_t;
+
+/******************************************************************************/
+int plasma_future_test(plasma_future_t *future);
+
+int plasma_future_wait(plasma_future_t *future);
+
+int plasma_future_destroy(plasma_future_t *future);
+
+int plasma_future_submit(int (*run)(void *args), void *args,
+                         plasma_callback_t callback, void *data,
+                         plasma_future_t **future);
+
+struct plasma_executor_s;
+void plasma_executor_finalize(struct plasma_executor_s *executor);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_FUTURE_H
@@ -0,0 +1,74 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_HANDLE_H
+#define PLASMA_HANDLE_H
+
+#include "plasma_types.h"
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @ingroup plasma_handle
+ *
+ * Persistent matrix handle.
+ *
+ * Couples a user matrix in LAPACK layout with a tile layout copy that
+ * stays allocated across calls. The state records which of the two copies
+ * holds the latest data, so translations are only done when needed:
+ * the tile copy is refreshed when a handle driver needs it and the LAPACK
+ * copy is refreshed when the user calls plasma_handle_sync().
+ *
+ * The fields are not meant to be accessed directly.
+ **/
+typedef struct {
+    plasma_desc_t A;     ///< tile layout copy of the matrix
+    void *pA;            ///< user matrix in LAPACK layout
+    int lda;             ///< leading dimension of pA
+    plasma_enum_t state; ///< PlasmaHandleSynced, etc.
+} plasma_handle_t;
+
+enum {
+    PlasmaHandleSynced,      ///< both copies hold the same data
+    PlasmaHandleLapackDirty, ///< the LAPACK copy is newer
+    PlasmaHandleTileDirty,   ///< the tile copy is newer
+    PlasmaHandleUnknown = INT_MAX // ensure int storage type in C++
+};
+
+/******************************************************************************/
+int plasma_handle_create(plasma_enum_t precision, int m, int n,
+                         void *pA, int lda, plasma_handle_t *handle);
+
+int plasma_handle_destroy(plasma_handle_t *handle);
+
+int plasma_handle_touch(plasma_handle_t *handle);
+
+int plasma_handle_sync(plasma_handle_t *handle);
+
+int plasma_handle_check(plasma_handle_t *handle, plasma_enum_t precision);
+
+void plasma_omp_handle_to_tile(plasma_handle_t *handle,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
+void plasma_omp_handle_to_lapack(plasma_handle_t *handle,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
+void plasma_handle_tile_modified(plasma_handle_t *handle);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_HANDLE_H
@@ -14,6 +14,16 @@
   #define priority(p)
 #endif
 
+// The affinity clause (OpenMP 5.0) is only a hint, drop it where unsupported.
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 11)) || \
+    (defined(__clang__) && (__clang_major__ < 11)) || \
+    defined(__INTEL_COMPILER)
+  #define affinity(...)
+#endif
+
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -39,6 +49,29 @@ static inline int imax(int a, int b)
         return b;
 }
 
+/******************************************************************************/
+// Priority of the tasks of step k of a factorization updating column n,
+// for the given lookahead: the closer the column to the panel, the higher,
+// up to the next lookahead panels, the rest of the trailing matrix at 0.
+// Panels themselves use lookahead+1. Capped by OMP_MAX_TASK_PRIORITY.
+static inline int plasma_lookahead_priority(int lookahead, int k, int n)
+{
+    int slack = n-k-1;
+    if (slack < lookahead)
+        return lookahead-slack;
+    else
+        return 0;
+}
+
+/******************************************************************************/
+void plasma_pge2desc_inplace(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
+void plasma_pdesc2ge_inplace(plasma_desc_t A,
+                             plasma_sequence_t *sequence,
+                             plasma_request_t *request);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -86,17 +86,30 @@ void plasma_pzgeqrf(plasma_desc_t A, plasma_desc_t T,
                     plasma_workspace_t work,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+int plasma_pzgeqrf_dryrun(plasma_desc_t A, int ib);
+
 void plasma_pzgeqrf_tree(plasma_desc_t A, plasma_desc_t T,
                          plasma_workspace_t work,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_pzgeqrf_static(plasma_desc_t A, plasma_desc_t T,
+                           plasma_workspace_t work,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void plasma_pzgetri_aux(plasma_desc_t A, plasma_desc_t W,
                         plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+int plasma_pzgetrf_dryrun(plasma_desc_t A);
+
+void plasma_pzgetrf_static(plasma_desc_t A, int *ipiv,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void plasma_pzge2gb(plasma_desc_t A, plasma_desc_t T,
                     plasma_workspace_t work,
                     plasma_sequence_t *sequence, plasma_request_t *request);    
@@ -195,6 +208,12 @@ void plasma_pzpbtrf(plasma_enum_t uplo, plasma_desc_t A,
 void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+int plasma_pzpotrf_dryrun(plasma_enum_t uplo, plasma_desc_t A);
+
+void plasma_pzpotrf_static(plasma_enum_t uplo, plasma_desc_t A,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void plasma_pzsymm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_complex64_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
@@ -0,0 +1,72 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_POOL_H
+#define PLASMA_POOL_H
+
+#include <stddef.h>
+#include <omp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+// Buffers are rounded up to one of 8 size classes per power of two,
+// starting at 4 KiB, so at most 1/8 of a buffer is wasted.
+#define PLASMA_POOL_MIN_LOG2      12
+#define PLASMA_POOL_CLASS_STEPS    8
+#define PLASMA_POOL_NUM_CLASSES  (PLASMA_POOL_CLASS_STEPS*(48-PLASMA_POOL_MIN_LOG2))
+
+// Default alignment of the buffers and size of the huge pages in bytes.
+#define PLASMA_POOL_ALIGNMENT     64
+#define PLASMA_POOL_HUGE_PAGE    ((size_t)2*1024*1024)
+
+/***************************************************************************//**
+ * @ingroup plasma_pool
+ *
+ * Memory pool recycling the tile storage of descriptors across calls.
+ *
+ * Freed buffers are kept in per size class free lists, up to a cap on
+ * the total number of cached bytes, and handed out again by later
+ * allocations of the same class, avoiding the page faults and zeroing
+ * of fresh memory. The pool is shared by all threads.
+ *
+ * Buffers are aligned to the given alignment. Buffers of at least one
+ * huge page can be backed by transparent huge pages (madvise) or by
+ * explicit huge pages (mmap with MAP_HUGETLB, falling back to transparent
+ * huge pages if none are reserved), reducing the TLB misses when
+ * striding through large tiles.
+ **/
+typedef struct {
+    omp_lock_t lock;                      ///< protects the free lists
+    void *free[PLASMA_POOL_NUM_CLASSES];  ///< free lists of cached buffers
+    size_t cached;                        ///< bytes held in the free lists
+    size_t cap;                           ///< limit on the cached bytes
+    int enabled;                          ///< PlasmaEnabled or PlasmaDisabled
+    size_t alignment;                     ///< alignment of the buffers
+    int huge_pages;                       ///< PlasmaHugePages
+} plasma_pool_t;
+
+/******************************************************************************/
+void plasma_pool_init(plasma_pool_t *pool);
+void plasma_pool_finalize(plasma_pool_t *pool);
+void plasma_pool_release(plasma_pool_t *pool);
+void plasma_pool_set_cap(plasma_pool_t *pool, size_t cap);
+void plasma_pool_set_alignment(plasma_pool_t *pool, size_t alignment);
+void plasma_pool_set_huge_pages(plasma_pool_t *pool, int huge_pages);
+
+void *plasma_pool_alloc(plasma_pool_t *pool, size_t size);
+void plasma_pool_free(plasma_pool_t *pool, void *ptr);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_POOL_H
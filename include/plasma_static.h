@@ -0,0 +1,51 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_STATIC_H
+#define PLASMA_STATIC_H
+
+#include "plasma_context.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * Grid of threads of the static scheduler. Tile (m, n) is owned by
+ * thread (m % p)*q + n % q, i.e., tiles are mapped block-cyclically,
+ * by columns with a 1 x q grid, in 2D with a p x q grid.
+ **/
+typedef struct {
+    int p;  ///< rows of the grid
+    int q;  ///< columns of the grid
+} plasma_static_grid_t;
+
+/******************************************************************************/
+static inline int plasma_static_owner(plasma_static_grid_t grid, int m, int n)
+{
+    return (m % grid.p)*grid.q + n % grid.q;
+}
+
+/******************************************************************************/
+plasma_static_grid_t plasma_static_grid_1d(int size);
+plasma_static_grid_t plasma_static_grid_2d(int size);
+
+int plasma_static_init(plasma_context_t *plasma, int m, int n);
+void plasma_static_finalize(plasma_context_t *plasma);
+void plasma_static_set(plasma_context_t *plasma, int m, int n, int val);
+int plasma_static_wait(plasma_context_t *plasma, int m, int n, int val);
+void plasma_static_abort(plasma_context_t *plasma);
+void plasma_static_run(void (*worker)(int rank, int size, void *arg),
+                       void *arg);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_STATIC_H
@@ -0,0 +1,82 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_STATS_H
+#define PLASMA_STATS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+#define PLASMA_STATS_MAX_ROUTINES  64
+#define PLASMA_STATS_MAX_KERNELS   64
+#define PLASMA_STATS_MAX_THREADS  256
+
+/***************************************************************************//**
+ * Statistics of the calls of one routine.
+ **/
+typedef struct {
+    const char *name;   ///< routine, e.g., "dgetrf"
+    int calls;          ///< number of calls
+    double time;        ///< wall time of the calls in seconds
+    double flops;       ///< floating point operations of the calls
+    double gflops;      ///< flops/time in Gflop/s
+} plasma_stats_routine_t;
+
+/***************************************************************************//**
+ * Statistics of the tasks of one kernel.
+ **/
+typedef struct {
+    const char *name;   ///< kernel, e.g., "dgemm"
+    long tasks;         ///< number of tasks
+    double time;        ///< time spent in the tasks in seconds
+} plasma_stats_kernel_t;
+
+/***************************************************************************//**
+ * Statistics gathered by plasma_get_stats() since the last
+ * plasma_reset_stats().
+ **/
+typedef struct {
+    int num_routines;
+    plasma_stats_routine_t routines[PLASMA_STATS_MAX_ROUTINES];
+
+    int num_kernels;
+    plasma_stats_kernel_t kernels[PLASMA_STATS_MAX_KERNELS];
+
+    int num_threads;                        ///< largest team of the calls
+    long tasks[PLASMA_STATS_MAX_THREADS];   ///< tasks run by each thread
+    double busy[PLASMA_STATS_MAX_THREADS];  ///< time in tasks of each thread
+
+    double time;    ///< wall time of all calls in seconds
+    double flops;   ///< floating point operations of all calls
+    double idle;    ///< team time of the calls not spent in tasks: idle
+                    ///  time, scheduling and layout translation overhead
+} plasma_stats_t;
+
+/******************************************************************************/
+// Whether the calls and tasks are counted, PlasmaStats.
+extern volatile int plasma_stats_enabled_g;
+
+/******************************************************************************/
+int plasma_get_stats(plasma_stats_t *stats);
+void plasma_reset_stats();
+
+void plasma_stats_enable(int enabled);
+double plasma_stats_start();
+void plasma_stats_stop(const char *name, double flops, double start);
+void plasma_stats_kernel(const char *name, uint64_t start, uint64_t stop);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_STATS_H
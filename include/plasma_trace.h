@@ -0,0 +1,103 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_TRACE_H
+#define PLASMA_TRACE_H
+
+#include "plasma_stats.h"
+
+#include <stdint.h>
+#if !defined(__x86_64__) && !defined(__i386__)
+#include <time.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * Event of a traced task: the kernel, the tile it writes and the clock ticks
+ * at its start and stop. The thread is the one of the buffer it is in.
+ **/
+typedef struct {
+    const char *name;   ///< kernel name, a string literal
+    const void *tile;   ///< address of the output tile
+    int m;              ///< number of rows of the output tile
+    int n;              ///< number of columns of the output tile
+    uint64_t start;     ///< plasma_trace_clock() at the start
+    uint64_t stop;      ///< plasma_trace_clock() at the stop
+} plasma_trace_event_t;
+
+/***************************************************************************//**
+ * Ring buffer of the events of one thread, written by that thread only,
+ * the oldest events being overwritten when it is full. The buffers are
+ * linked in a list of all buffers, pushed to without locks.
+ **/
+typedef struct plasma_trace_buffer_s {
+    plasma_trace_event_t *events;
+    int size;                            ///< capacity, a power of two
+    int thread;                          ///< index of the thread in traces
+    uint64_t count;                      ///< number of events recorded
+    struct plasma_trace_buffer_s *next;  ///< next buffer of the list
+} plasma_trace_buffer_t;
+
+/******************************************************************************/
+// Whether the tasks record events, PlasmaTrace.
+extern volatile int plasma_trace_enabled_g;
+
+/******************************************************************************/
+int plasma_trace_write(const char *filename);
+int plasma_trace_summary(const char *filename);
+void plasma_trace_clear();
+
+void plasma_trace_enable(int enabled);
+void plasma_trace_calibrate();
+double plasma_trace_ticks_per_us();
+void plasma_trace_init();
+void plasma_trace_finalize();
+void plasma_trace_event(const char *name, const void *tile, int m, int n,
+                        uint64_t start, uint64_t stop);
+
+/******************************************************************************/
+// Returns the time stamp counter, or nanoseconds where there is none.
+static inline uint64_t plasma_trace_clock()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    uint32_t lo, hi;
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((uint64_t)hi << 32) | lo;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+#endif
+}
+
+/******************************************************************************/
+// Returns the start of a task, 0 if neither tracing nor statistics are on.
+static inline uint64_t plasma_trace_start()
+{
+    return plasma_trace_enabled_g || plasma_stats_enabled_g ?
+           plasma_trace_clock() : 0;
+}
+
+/******************************************************************************/
+// Records the event of a task started by plasma_trace_start().
+static inline void plasma_trace_stop(const char *name, const void *tile,
+                                     int m, int n, uint64_t start)
+{
+    if (start != 0)
+        plasma_trace_event(name, tile, m, n, start, plasma_trace_clock());
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_TRACE_H
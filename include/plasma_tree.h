@@ -10,6 +10,11 @@
 #ifndef PLASMA_TREE_H
 #define PLASMA_TREE_H
 
+#include "plasma_async.h"
+#include "plasma_types.h"
+
+#include <assert.h>
+
 enum {
     PlasmaGeKernel = 1,
     PlasmaTtKernel = 2,
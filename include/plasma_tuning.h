@@ -17,8 +17,17 @@ extern "C" {
 #endif
 
 /******************************************************************************/
+int plasma_autotune(const char *routine, plasma_enum_t dtyp, int n);
+int plasma_tuning_load(const char *filename);
+int plasma_tuning_save(const char *filename);
+int plasma_tuning_invalidate();
+
 void plasma_tuning_init(plasma_context_t *plasma);
 void plasma_tuning_finalize(plasma_context_t *plasma);
+int plasma_tuning_record(plasma_context_t *plasma, const char *routine,
+                         plasma_enum_t dtyp, int num_threads, int size,
+                         int nb, int ib, int max_panel_threads, int small);
+int plasma_tuning_autosave(plasma_context_t *plasma);
 
 void plasma_tune_gbmm(plasma_context_t *plasma, plasma_enum_t dtyp,
                       int m, int n, int k, int kl, int ku);
@@ -142,6 +142,33 @@ enum {
     PlasmaInoutUnknown = INT_MAX // ensure int storage type in C++
 };
 
+enum {
+    PlasmaNumaDefault,
+    PlasmaNumaInterleave,
+    PlasmaNumaTileCyclic,
+    PlasmaNumaUnknown = INT_MAX // ensure int storage type in C++
+};
+
+enum {
+    PlasmaHugePagesNone,
+    PlasmaHugePagesTransparent,
+    PlasmaHugePagesExplicit,
+    PlasmaHugePagesUnknown = INT_MAX // ensure int storage type in C++
+};
+
+enum {
+    PlasmaBarrierSpin,
+    PlasmaBarrierBackoff,
+    PlasmaBarrierBlocking,
+    PlasmaBarrierUnknown = INT_MAX // ensure int storage type in C++
+};
+
+enum {
+    PlasmaDynamicScheduling,
+    PlasmaStaticScheduling,
+    PlasmaSchedulingUnknown = INT_MAX // ensure int storage type in C++
+};
+
 enum {
     PlasmaFlatHouseholder,
     PlasmaTreeHouseholder,
@@ -161,6 +188,23 @@ enum {
     PlasmaInplaceOutplace,
     PlasmaNumPanelThreads,
     PlasmaHouseholderMode,
+    PlasmaMemoryPool,
+    PlasmaMemoryPoolCap,
+    PlasmaNumaPolicy,
+    PlasmaAlignment,
+    PlasmaHugePages,
+    PlasmaTilePadding,
+    PlasmaBarrierMode,
+    PlasmaNumThreads,
+    PlasmaTaskReplay,
+    PlasmaScheduling,
+    PlasmaLookahead,
+    PlasmaSmallSize,
+    PlasmaSmallNumThreads,
+    PlasmaTrace,
+    PlasmaStats,
+    PlasmaHouseholderTree,
+    PlasmaDryRun,
     PlasmaParamUnknown = INT_MAX // ensure int storage type in C++
 };
 
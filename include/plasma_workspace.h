@@ -11,6 +11,7 @@
 #define PLASMA_WORKSPACE_H
 
 #include "plasma_types.h"
+#include "plasma_pool.h"
 
 #include <stdlib.h>
 #include <assert.h>
@@ -24,14 +25,34 @@ typedef struct {
     size_t lworkspace;  ///< length in elements of workspace on each core
     int nthread;        ///< number of threads
     plasma_enum_t dtyp; ///< precision of the workspace
+    int persistent;     ///< spaces belong to the context's scratch area
 } plasma_workspace_t;
 
+/***************************************************************************//**
+ * Persistent per-thread scratch area of the context.
+ * Grows on demand and is kept across calls, so that workspaces created by
+ * the drivers draw from it without allocating. Held by one workspace at
+ * a time, other workspaces are allocated per call.
+ **/
+typedef struct {
+    void **spaces;      ///< array of nthread pointers to the buffers
+    size_t size;        ///< size in bytes of each buffer
+    int nthread;        ///< number of buffers
+    int busy;           ///< set while held by a workspace
+} plasma_scratch_t;
+
 /******************************************************************************/
 int plasma_workspace_create(plasma_workspace_t *workspace, size_t lworkspace,
                            plasma_enum_t dtyp);
 
 int plasma_workspace_destroy(plasma_workspace_t *workspace);
 
+int plasma_workspace_reserve(size_t size);
+int plasma_workspace_release();
+
+void plasma_scratch_init(plasma_scratch_t *scratch);
+void plasma_scratch_free(plasma_scratch_t *scratch, plasma_pool_t *pool);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
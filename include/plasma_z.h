@@ -16,6 +16,8 @@
 #include "plasma_async.h"
 #include "plasma_barrier.h"
 #include "plasma_descriptor.h"
+#include "plasma_future.h"
+#include "plasma_handle.h"
 #include "plasma_workspace.h"
 #include "plasma_zlaebz2_work.h"
 
@@ -76,10 +78,36 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
                                            plasma_complex64_t *pB, int ldb,
                  plasma_complex64_t beta,  plasma_complex64_t *pC, int ldc);
 
+int plasma_zgemm_batch(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       plasma_complex64_t alpha,
+                       plasma_complex64_t **pA, int lda,
+                       plasma_complex64_t **pB, int ldb,
+                       plasma_complex64_t beta,
+                       plasma_complex64_t **pC, int ldc,
+                       int batch_count);
+
+int plasma_zgemm_vbatch(plasma_enum_t transa, plasma_enum_t transb,
+                        const int *m, const int *n, const int *k,
+                        plasma_complex64_t alpha,
+                        plasma_complex64_t **pA, const int *lda,
+                        plasma_complex64_t **pB, const int *ldb,
+                        plasma_complex64_t beta,
+                        plasma_complex64_t **pC, const int *ldc,
+                        int batch_count);
+
 int plasma_zgeqrf(int m, int n,
                   plasma_complex64_t *pA, int lda,
                   plasma_desc_t *T);
 
+int plasma_zgeqrf_batch(int m, int n,
+                        plasma_complex64_t **pA, int lda,
+                        plasma_complex64_t **pTau, int batch_count);
+
+int plasma_zgeqrf_vbatch(const int *m, const int *n,
+                         plasma_complex64_t **pA, const int *lda,
+                         plasma_complex64_t **pTau, int batch_count);
+
 int plasma_zgeqrs(int m, int n, int nrhs,
                   plasma_complex64_t *pA, int lda,
                   plasma_desc_t T,
@@ -89,6 +117,12 @@ int plasma_zgesv(int n, int nrhs,
                  plasma_complex64_t *pA, int lda, int *ipiv,
                  plasma_complex64_t *pB, int ldb);
 
+int plasma_zgesv_async(int n, int nrhs,
+                       plasma_complex64_t *pA, int lda, int *ipiv,
+                       plasma_complex64_t *pB, int ldb,
+                       plasma_callback_t callback, void *data,
+                       plasma_future_t **future);
+
 void plasma_omp_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
                        plasma_desc_t A, plasma_desc_t T,
                        double *S,
@@ -108,6 +142,16 @@ int plasma_zgesdd(plasma_enum_t jobu, plasma_enum_t jobvt,
 int plasma_zgetrf(int m, int n,
                   plasma_complex64_t *pA, int lda, int *ipiv);
 
+int plasma_zgetrf_handle(plasma_handle_t *A, int *ipiv);
+
+int plasma_zgetrf_batch(int m, int n,
+                        plasma_complex64_t **pA, int lda, int **pipiv,
+                        int batch_count, int *info);
+
+int plasma_zgetrf_vbatch(const int *m, const int *n,
+                         plasma_complex64_t **pA, const int *lda, int **pipiv,
+                         int batch_count, int *info);
+
 int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv);
 
 int plasma_zgetri_aux(int n, plasma_complex64_t *pA, int lda);
@@ -116,6 +160,19 @@ int plasma_zgetrs(plasma_enum_t trans, int n, int nrhs,
                   plasma_complex64_t *pA, int lda, int *ipiv,
                   plasma_complex64_t *pB, int ldb);
 
+int plasma_zgetrs_handle(plasma_enum_t trans, plasma_handle_t *A, int *ipiv,
+                         int nrhs, plasma_complex64_t *pB, int ldb);
+
+int plasma_zgetrs_batch(int n, int nrhs,
+                        plasma_complex64_t **pA, int lda, int **pipiv,
+                        plasma_complex64_t **pB, int ldb,
+                        int batch_count);
+
+int plasma_zgetrs_vbatch(const int *n, const int *nrhs,
+                         plasma_complex64_t **pA, const int *lda, int **pipiv,
+                         plasma_complex64_t **pB, const int *ldb,
+                         int batch_count);
+
 int plasma_zhemm(plasma_enum_t side, plasma_enum_t uplo,
                  int m, int n,
                  plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
@@ -228,10 +285,27 @@ int plasma_zposv(plasma_enum_t uplo,
                  plasma_complex64_t *pA, int lda,
                  plasma_complex64_t *pB, int ldb);
 
+int plasma_zposv_async(plasma_enum_t uplo,
+                       int n, int nrhs,
+                       plasma_complex64_t *pA, int lda,
+                       plasma_complex64_t *pB, int ldb,
+                       plasma_callback_t callback, void *data,
+                       plasma_future_t **future);
+
 int plasma_zpotrf(plasma_enum_t uplo,
                   int n,
                   plasma_complex64_t *pA, int lda);
 
+int plasma_zpotrf_handle(plasma_enum_t uplo, plasma_handle_t *A);
+
+int plasma_zpotrf_batch(plasma_enum_t uplo, int n,
+                        plasma_complex64_t **pA, int lda,
+                        int batch_count, int *info);
+
+int plasma_zpotrf_vbatch(plasma_enum_t uplo, const int *n,
+                         plasma_complex64_t **pA, const int *lda,
+                         int batch_count, int *info);
+
 int plasma_zpotri(plasma_enum_t uplo,
                   int n,
                   plasma_complex64_t *pA, int lda);
@@ -241,6 +315,19 @@ int plasma_zpotrs(plasma_enum_t uplo,
                   plasma_complex64_t *pA, int lda,
                   plasma_complex64_t *pB, int ldb);
 
+int plasma_zpotrs_handle(plasma_enum_t uplo, plasma_handle_t *A, int nrhs,
+                         plasma_complex64_t *pB, int ldb);
+
+int plasma_zpotrs_batch(plasma_enum_t uplo, int n, int nrhs,
+                        plasma_complex64_t **pA, int lda,
+                        plasma_complex64_t **pB, int ldb,
+                        int batch_count);
+
+int plasma_zpotrs_vbatch(plasma_enum_t uplo, const int *n, const int *nrhs,
+                         plasma_complex64_t **pA, const int *lda,
+                         plasma_complex64_t **pB, const int *ldb,
+                         int batch_count);
+
 int plasma_zstevx2(plasma_enum_t jobtype, plasma_enum_t range, int n, int k, 
                    plasma_complex64_t *diag, plasma_complex64_t *offd,
                    plasma_complex64_t vl, plasma_complex64_t vu, int il,
@@ -0,0 +1,621 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "test.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <omp.h>
+
+/******************************************************************************/
+// maximum number of routines and thread counts of a sweep
+static const int MaxRoutines = 1024;
+static const int MaxThreads = 256;
+
+// maximum length of a line of the baseline
+static const int LineLen = 1024;
+
+// timings of one configuration of a routine
+typedef struct {
+    const char *routine;
+    int m, n, k;       // dimensions, 0 if not used by the routine
+    int nb, ib;        // tile sizes, 0 if not used by the routine
+    int threads;       // number of threads
+    int repeat;        // number of timed runs
+    double min;        // minimum time
+    double median;     // median time
+    double mean;       // mean time
+    double stddev;     // standard deviation of the time
+    double gflops;     // GFLOPS rate at the median time
+    double baseline;   // median time of the baseline, 0 if none
+} bench_result_t;
+
+// options of the benchmark, besides those of the tester
+typedef struct {
+    int warmup;             // number of untimed runs
+    int repeat;             // number of timed runs
+    const char *precisions; // precisions of routines given without one
+    const char *format;     // text, csv or json
+    const char *output;     // output file, NULL for standard output
+    const char *baseline;   // baseline file, NULL for none
+    double threshold;       // relative slowdown reported as regression
+} bench_options_t;
+
+/***************************************************************************//**
+ *
+ * @brief Prints usage information.
+ *
+ ******************************************************************************/
+static void bench_usage(const char *program_name)
+{
+    printf("Usage:\n"
+           "\t%s [-h|--help]\n"
+           "\t%s routine1 [routine2 ...] [parameter1, parameter2, ...]\n"
+           "\n"
+           "Routines are named as for the tester (dgetrf), without the\n"
+           "precision to run all precisions (getrf), or all.\n"
+           "\n"
+           "Options:\n"
+           "\t%*sshow this screen\n"
+           "\t%*snumber of untimed runs [default: 1]\n"
+           "\t%*snumber of timed runs [default: 5]\n"
+           "\t%*sprecisions of routines given without one [default: sdcz]\n"
+           "\t%*snumbers of threads [default: OMP_NUM_THREADS]\n"
+           "\t%*soutput format: text, csv or json [default: text]\n"
+           "\t%*soutput file [default: standard output]\n"
+           "\t%*sCSV output of an earlier run to compare with\n"
+           "\t%*srelative increase of the median time reported as\n"
+           "\t%*sa regression [default: 0.05]\n"
+           "\n"
+           "Each routine is run for every combination of --dim, --nb, --ib\n"
+           "(if it uses them) and --threads. Other options of the tester\n"
+           "(e.g., --uplo=u, --nrhs=10) take a single value.\n"
+           "Returns the number of regressions from the baseline.\n",
+           program_name, program_name,
+           DescriptionIndent, "-h --help",
+           DescriptionIndent, "--warmup=",
+           DescriptionIndent, "--repeat=",
+           DescriptionIndent, "--precisions=",
+           DescriptionIndent, "--threads=",
+           DescriptionIndent, "--format=",
+           DescriptionIndent, "--output=",
+           DescriptionIndent, "--baseline=",
+           DescriptionIndent, "--threshold=",
+           DescriptionIndent, "");
+}
+
+/***************************************************************************//**
+ *
+ * @brief Finds a routine of the tester.
+ *
+ * @retval index of the routine in routines, -1 if there is none
+ *
+ ******************************************************************************/
+static int bench_find_routine(const char *name)
+{
+    if (name[0] == '\0')
+        return -1;
+    for (int i = 0; routines[i].name != NULL; ++i) {
+        if (strcmp(name, routines[i].name) == 0)
+            return i;
+    }
+    return -1;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Adds the routines named by an argument to the list of the sweep:
+ *        the routine itself, the routine in the given precisions,
+ *        or all routines in the given precisions.
+ *
+ * @retval number of routines added
+ *
+ ******************************************************************************/
+static int bench_add_routines(const char *name, const char *precisions,
+                              const char *list[], int *num)
+{
+    int added = 0;
+    int i = bench_find_routine(name);
+    if (i >= 0) {
+        if (*num < MaxRoutines)
+            list[(*num)++] = routines[i].name;
+        return 1;
+    }
+    for (i = 0; routines[i].name != NULL; ++i) {
+        const char *routine = routines[i].name;
+        if (routine[0] == '\0' || strchr(precisions, routine[0]) == NULL)
+            continue;
+        if (strcmp(name, "all") == 0 || strcmp(name, routine+1) == 0) {
+            if (*num < MaxRoutines)
+                list[(*num)++] = routine;
+            added++;
+        }
+    }
+    return added;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Compares doubles for qsort.
+ *
+ ******************************************************************************/
+static int bench_compare(const void *a, const void *b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/***************************************************************************//**
+ *
+ * @brief Runs a routine for one configuration and gathers the statistics
+ *        of its timed runs.
+ *
+ * @param[in]     name   - routine name
+ * @param[in,out] pval   - array of parameter values
+ * @param[in]     opts   - options of the benchmark
+ * @param[out]    result - statistics of the runs
+ *
+ ******************************************************************************/
+static void bench_routine(const char *name, param_value_t pval[],
+                          const bench_options_t *opts, bench_result_t *result)
+{
+    for (int i = 0; i < opts->warmup; i++)
+        run_routine(name, pval, true);
+
+    double *time = (double*)malloc(opts->repeat*sizeof(double));
+    assert(time != NULL);
+    double gflop = 0.0;
+    for (int i = 0; i < opts->repeat; i++) {
+        run_routine(name, pval, true);
+        time[i] = pval[PARAM_TIME].d;
+        gflop = pval[PARAM_GFLOPS].d*pval[PARAM_TIME].d;
+    }
+
+    qsort(time, opts->repeat, sizeof(double), bench_compare);
+    int half = opts->repeat/2;
+    result->min = time[0];
+    result->median = opts->repeat%2 == 1 ?
+                     time[half] : (time[half-1]+time[half])/2.0;
+    result->mean = 0.0;
+    for (int i = 0; i < opts->repeat; i++)
+        result->mean += time[i];
+    result->mean /= opts->repeat;
+    result->stddev = 0.0;
+    if (opts->repeat > 1) {
+        for (int i = 0; i < opts->repeat; i++)
+            result->stddev += (time[i]-result->mean)*(time[i]-result->mean);
+        result->stddev = sqrt(result->stddev/(opts->repeat-1));
+    }
+    result->gflops = result->median > 0.0 ? gflop/result->median : 0.0;
+    result->repeat = opts->repeat;
+    free(time);
+}
+
+/***************************************************************************//**
+ *
+ * @brief Reads the CSV output of an earlier run.
+ *
+ * @param[in]  filename - CSV file
+ * @param[out] baseline - array of results, to be freed by the caller
+ * @param[out] num      - number of results
+ *
+ * @retval 1 - failure
+ * @retval 0 - success
+ *
+ ******************************************************************************/
+static int bench_read_baseline(const char *filename,
+                               bench_result_t **baseline, int *num)
+{
+    FILE *file = fopen(filename, "r");
+    if (file == NULL)
+        return 1;
+
+    int size = 256;
+    *num = 0;
+    *baseline = (bench_result_t*)malloc(size*sizeof(bench_result_t));
+    assert(*baseline != NULL);
+
+    char line[LineLen];
+    char routine[LineLen];
+    while (fgets(line, LineLen, file) != NULL) {
+        bench_result_t r;
+        // The header and anything else not a result are skipped.
+        int cnt = sscanf(line, "%[^,],%d,%d,%d,%d,%d,%d,%d,%lf,%lf",
+                         routine, &r.m, &r.n, &r.k, &r.nb, &r.ib,
+                         &r.threads, &r.repeat, &r.min, &r.median);
+        if (cnt != 10)
+            continue;
+        if (*num == size) {
+            size *= 2;
+            *baseline = (bench_result_t*)realloc(
+                *baseline, size*sizeof(bench_result_t));
+            assert(*baseline != NULL);
+        }
+        r.routine = strdup(routine);
+        (*baseline)[(*num)++] = r;
+    }
+    fclose(file);
+    return 0;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Returns the median time of the same configuration in the baseline,
+ *        0 if there is none.
+ *
+ ******************************************************************************/
+static double bench_find_baseline(const bench_result_t *r,
+                                  const bench_result_t *baseline, int num)
+{
+    for (int i = 0; i < num; i++) {
+        const bench_result_t *b = &baseline[i];
+        if (strcmp(r->routine, b->routine) == 0 &&
+            r->m == b->m && r->n == b->n && r->k == b->k &&
+            r->nb == b->nb && r->ib == b->ib && r->threads == b->threads)
+            return b->median;
+    }
+    return 0.0;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Checks if a result is slower than its baseline by more than
+ *        the threshold.
+ *
+ ******************************************************************************/
+static bool bench_regressed(const bench_result_t *r, double threshold)
+{
+    return r->baseline > 0.0 && r->median > r->baseline*(1.0+threshold);
+}
+
+/***************************************************************************//**
+ *
+ * @brief Prints column headers of the text output.
+ *
+ ******************************************************************************/
+static void bench_print_header(FILE *file, bool baseline)
+{
+    fprintf(file, "\n%-*s  %7s  %6s  %6s  %6s  %5s  %5s"
+                  "  %*s  %*s  %*s  %*s",
+            InfoSpacing, "routine", "threads", "m", "n", "k", "nb", "ib",
+            InfoSpacing, "min", InfoSpacing, "median",
+            InfoSpacing, "stddev", InfoSpacing, "gflops");
+    if (baseline)
+        fprintf(file, "  %*s  %*s  %10s",
+                InfoSpacing, "baseline", InfoSpacing, "ratio", "status");
+    fprintf(file, "\n\n");
+}
+
+/***************************************************************************//**
+ *
+ * @brief Prints a result in the text output.
+ *
+ ******************************************************************************/
+static void bench_print_result(FILE *file, const bench_result_t *r,
+                               bool baseline, double threshold)
+{
+    fprintf(file, "%-*s  %7d  %6d  %6d  %6d  %5d  %5d"
+                  "  %*.4f  %*.4f  %*.4f  %*.4f",
+            InfoSpacing, r->routine, r->threads, r->m, r->n, r->k,
+            r->nb, r->ib,
+            InfoSpacing, r->min, InfoSpacing, r->median,
+            InfoSpacing, r->stddev, InfoSpacing, r->gflops);
+    if (baseline) {
+        if (r->baseline > 0.0)
+            fprintf(file, "  %*.4f  %*.4f  %10s",
+                    InfoSpacing, r->baseline,
+                    InfoSpacing, r->median/r->baseline,
+                    bench_regressed(r, threshold) ? "REGRESSION" : "ok");
+        else
+            fprintf(file, "  %*s  %*s  %10s",
+                    InfoSpacing, "--", InfoSpacing, "--", "--");
+    }
+    fprintf(file, "\n");
+    fflush(file);
+}
+
+/***************************************************************************//**
+ *
+ * @brief Writes the results in CSV, with a header line.
+ *
+ ******************************************************************************/
+static void bench_write_csv(FILE *file, const bench_result_t results[],
+                            int num, double threshold)
+{
+    fprintf(file, "routine,m,n,k,nb,ib,threads,repeat,"
+                  "min,median,mean,stddev,gflops,baseline,regression\n");
+    for (int i = 0; i < num; i++) {
+        const bench_result_t *r = &results[i];
+        fprintf(file, "%s,%d,%d,%d,%d,%d,%d,%d,%.6e,%.6e,%.6e,%.6e,%.4f,"
+                      "%.6e,%d\n",
+                r->routine, r->m, r->n, r->k, r->nb, r->ib,
+                r->threads, r->repeat,
+                r->min, r->median, r->mean, r->stddev, r->gflops,
+                r->baseline, bench_regressed(r, threshold));
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @brief Writes the results in JSON.
+ *
+ ******************************************************************************/
+static void bench_write_json(FILE *file, const bench_result_t results[],
+                             int num, const bench_options_t *opts)
+{
+    fprintf(file, "{\n"
+                  "  \"version\": \"%d.%d.%d\",\n"
+                  "  \"warmup\": %d,\n"
+                  "  \"repeat\": %d,\n"
+                  "  \"threshold\": %g,\n"
+                  "  \"results\": [",
+            PLASMA_VERSION_MAJOR, PLASMA_VERSION_MINOR, PLASMA_VERSION_PATCH,
+            opts->warmup, opts->repeat, opts->threshold);
+    for (int i = 0; i < num; i++) {
+        const bench_result_t *r = &results[i];
+        fprintf(file, "%s\n    {\"routine\": \"%s\", "
+                      "\"m\": %d, \"n\": %d, \"k\": %d, "
+                      "\"nb\": %d, \"ib\": %d, \"threads\": %d, "
+                      "\"min\": %.6e, \"median\": %.6e, \"mean\": %.6e, "
+                      "\"stddev\": %.6e, \"gflops\": %.4f",
+                i == 0 ? "" : ",",
+                r->routine, r->m, r->n, r->k, r->nb, r->ib, r->threads,
+                r->min, r->median, r->mean, r->stddev, r->gflops);
+        if (r->baseline > 0.0)
+            fprintf(file, ", \"baseline\": %.6e, \"regression\": %s",
+                    r->baseline,
+                    bench_regressed(r, opts->threshold) ? "true" : "false");
+        fprintf(file, "}");
+    }
+    fprintf(file, "\n  ]\n}\n");
+}
+
+/***************************************************************************//**
+ *
+ * @brief Benchmarks PLASMA routines over sweeps of their parameters.
+ *        Prints usage information when ran without options.
+ *
+ * @param[in] argc
+ * @param[in] argv
+ *
+ * @retval EXIT_SUCCESS - no regressions
+ * @retval EXIT_FAILURE - incorrect invocation
+ * @retval > 0 - number of regressions from the baseline
+ *
+ ******************************************************************************/
+int main(int argc, char **argv)
+{
+    if (argc == 1 ||
+        strcmp(argv[1], "-h") == 0 ||
+        strcmp(argv[1], "--help") == 0) {
+
+        bench_usage(argv[0]);
+        return EXIT_SUCCESS;
+    }
+
+    //================================================================
+    // Read the routines and the options of the benchmark.
+    // Timing runs are not tested unless --test=y is given.
+    //================================================================
+    bench_options_t opts = {
+        .warmup = 1, .repeat = 5, .precisions = "sdcz", .format = "text",
+        .output = NULL, .baseline = NULL, .threshold = 0.05
+    };
+    const char *thread_list = NULL;
+
+    const char **list = (const char**)malloc(MaxRoutines*sizeof(char*));
+    char **targv = (char**)malloc((argc+2)*sizeof(char*));
+    assert(list != NULL && targv != NULL);
+    int num_routines = 0;
+    int targc = 0;
+    targv[targc++] = argv[0];
+    targv[targc++] = "bench";
+    targv[targc++] = "--test=n";
+
+    const char **names = (const char**)malloc(argc*sizeof(char*));
+    assert(names != NULL);
+    int num_names = 0;
+    for (int i = 1; i < argc; i++) {
+        const char *value = strchr(argv[i], '=') ? strchr(argv[i], '=')+1 : "";
+        if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            bench_usage(argv[0]);
+            return EXIT_SUCCESS;
+        }
+        else if (param_starts_with(argv[i], "--warmup="))
+            opts.warmup = atoi(value);
+        else if (param_starts_with(argv[i], "--repeat="))
+            opts.repeat = atoi(value);
+        else if (param_starts_with(argv[i], "--precisions="))
+            opts.precisions = value;
+        else if (param_starts_with(argv[i], "--threads="))
+            thread_list = value;
+        else if (param_starts_with(argv[i], "--format="))
+            opts.format = value;
+        else if (param_starts_with(argv[i], "--output="))
+            opts.output = value;
+        else if (param_starts_with(argv[i], "--baseline="))
+            opts.baseline = value;
+        else if (param_starts_with(argv[i], "--threshold="))
+            opts.threshold = atof(value);
+        else if (param_starts_with(argv[i], "--"))
+            targv[targc++] = argv[i];
+        else
+            names[num_names++] = argv[i];
+    }
+    if (opts.warmup < 0 || opts.repeat < 1 || opts.threshold < 0.0) {
+        printf("invalid --warmup, --repeat or --threshold\n");
+        return EXIT_FAILURE;
+    }
+    if (strcmp(opts.format, "text") != 0 &&
+        strcmp(opts.format, "csv") != 0 &&
+        strcmp(opts.format, "json") != 0) {
+        printf("unknown format: %s\n", opts.format);
+        return EXIT_FAILURE;
+    }
+    for (int i = 0; i < num_names; i++) {
+        if (bench_add_routines(names[i], opts.precisions,
+                               list, &num_routines) == 0) {
+            printf("unknown routine: %s\n", names[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (num_routines == 0) {
+        printf("no routine to benchmark\n");
+        return EXIT_FAILURE;
+    }
+
+    int threads[MaxThreads];
+    int num_threads = 0;
+    if (thread_list == NULL) {
+        threads[num_threads++] = omp_get_max_threads();
+    }
+    else {
+        const char *str = thread_list;
+        while (true) {
+            int start, end, step;
+            if (scan_irange(&str, &start, &end, &step) != 0 || start < 1) {
+                printf("error scanning argument: --threads=%s\n",
+                       thread_list);
+                return EXIT_FAILURE;
+            }
+            for (int t = start; t <= end && num_threads < MaxThreads;
+                 t += step > 0 ? step : 1)
+                threads[num_threads++] = t;
+            if (*str == '\0')
+                break;
+            str += 1;
+        }
+    }
+
+    // The options of the tester.
+    param_t param[PARAM_SIZEOF];
+    param_value_t pval[PARAM_SIZEOF];
+    param_init(param);
+    param_read(targc, targv, param);
+
+    //================================================================
+    // Read the baseline.
+    //================================================================
+    bench_result_t *baseline = NULL;
+    int num_baseline = 0;
+    if (opts.baseline != NULL &&
+        bench_read_baseline(opts.baseline, &baseline, &num_baseline) != 0) {
+        printf("cannot read baseline: %s\n", opts.baseline);
+        return EXIT_FAILURE;
+    }
+
+    FILE *output = stdout;
+    if (opts.output != NULL) {
+        output = fopen(opts.output, "w");
+        if (output == NULL) {
+            printf("cannot open output: %s\n", opts.output);
+            return EXIT_FAILURE;
+        }
+    }
+    // Text rows are printed as they come, to the output if in text,
+    // else to the terminal unless the output goes there.
+    bool text = strcmp(opts.format, "text") == 0;
+    FILE *rows = text ? output : (opts.output != NULL ? stdout : NULL);
+    if (rows != NULL)
+        bench_print_header(rows, baseline != NULL);
+
+    //================================================================
+    // Sweep threads, routines, dimensions and tile sizes.
+    //================================================================
+    int size = 256;
+    int num = 0;
+    bench_result_t *results =
+        (bench_result_t*)malloc(size*sizeof(bench_result_t));
+    assert(results != NULL);
+
+    plasma_init();
+    for (int t = 0; t < num_threads; t++) {
+        plasma_set(PlasmaNumThreads, threads[t]);
+        for (int i = 0; i < num_routines; i++) {
+            const char *name = list[i];
+            param_snap(param, pval);
+            run_routine(name, pval, false);
+            int used_dim = pval[PARAM_DIM].used;
+            int num_nb = pval[PARAM_NB].used ? param[PARAM_NB].num : 1;
+            int num_ib = pval[PARAM_IB].used ? param[PARAM_IB].num : 1;
+
+            for (int d = 0; d < param[PARAM_DIM].num; d++) {
+                for (int b = 0; b < num_nb; b++) {
+                    for (int c = 0; c < num_ib; c++) {
+                        pval[PARAM_DIM].dim = param[PARAM_DIM].val[d].dim;
+                        pval[PARAM_NB].i = param[PARAM_NB].val[b].i;
+                        pval[PARAM_IB].i = param[PARAM_IB].val[c].i;
+
+                        bench_result_t r;
+                        r.routine = name;
+                        r.m = used_dim & PARAM_USE_M ? pval[PARAM_DIM].dim.m : 0;
+                        r.n = used_dim & PARAM_USE_N ? pval[PARAM_DIM].dim.n : 0;
+                        r.k = used_dim & PARAM_USE_K ? pval[PARAM_DIM].dim.k : 0;
+                        r.nb = pval[PARAM_NB].used ? pval[PARAM_NB].i : 0;
+                        r.ib = pval[PARAM_IB].used ? pval[PARAM_IB].i : 0;
+                        r.threads = threads[t];
+
+                        bench_routine(name, pval, &opts, &r);
+                        r.baseline = bench_find_baseline(&r, baseline,
+                                                         num_baseline);
+                        if (rows != NULL)
+                            bench_print_result(rows, &r, baseline != NULL,
+                                               opts.threshold);
+
+                        if (num == size) {
+                            size *= 2;
+                            results = (bench_result_t*)realloc(
+                                results, size*sizeof(bench_result_t));
+                            assert(results != NULL);
+                        }
+                        results[num++] = r;
+                    }
+                }
+            }
+        }
+    }
+    plasma_finalize();
+
+    //================================================================
+    // Write the results and count the regressions.
+    //================================================================
+    if (strcmp(opts.format, "csv") == 0)
+        bench_write_csv(output, results, num, opts.threshold);
+    else if (strcmp(opts.format, "json") == 0)
+        bench_write_json(output, results, num, &opts);
+    if (output != stdout)
+        fclose(output);
+
+    int regressions = 0;
+    for (int i = 0; i < num; i++) {
+        if (bench_regressed(&results[i], opts.threshold))
+            regressions++;
+    }
+    if (baseline != NULL) {
+        fprintf(rows != NULL ? rows : stderr,
+                "\n%d of %d timings regressed by more than %.0f%%\n",
+                regressions, num, 100.0*opts.threshold);
+        for (int i = 0; i < num_baseline; i++)
+            free((void*)baseline[i].routine);
+        free(baseline);
+    }
+
+    free(results);
+    free(names);
+    free(targv);
+    free(list);
+    return regressions;
+}
@@ -0,0 +1,84 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "test.h"
+#include "plasma.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests and times a PLASMA routine.
+ *        Prints usage information when ran without options.
+ *
+ * @param[in] argc
+ * @param[in] argv
+ *
+ * @retval EXIT_SUCCESS - correct invocation
+ * @retval EXIT_FAILURE - incorrect invocation
+ * @retval > 0 - number of tests that failed
+ *
+ ******************************************************************************/
+int main(int argc, char **argv)
+{
+    if (argc == 1 ||
+        strcmp(argv[1], "-h") == 0 ||
+        strcmp(argv[1], "--help") == 0) {
+
+        print_main_usage(argv[0]);
+        return EXIT_SUCCESS;
+    }
+
+    if (strcmp(argv[1], "-v") == 0 ||
+        strcmp(argv[1], "--version") == 0) {
+        printf("PLASMA version %d.%d.%d\n",
+            PLASMA_VERSION_MAJOR, PLASMA_VERSION_MINOR, PLASMA_VERSION_PATCH);
+
+        return EXIT_SUCCESS;
+    }
+
+    const char *routine = argv[1];
+
+    param_t param[PARAM_SIZEOF];      // set of parameters
+    param_value_t pval[PARAM_SIZEOF]; // snapshot of values
+
+    param_init(param);
+    param_read(argc, argv, param);
+    int  iter  = param[PARAM_ITER].val[0].i;
+    bool outer = param[PARAM_OUTER].val[0].c == 'y';
+    bool test  = param[PARAM_TEST].val[0].c == 'y';
+    bool inplace = param[PARAM_INPLACE].val[0].c == 'y';
+    int err = 0;
+
+    // Print labels.
+    param_snap(param, pval);
+    print_header(routine, pval);
+
+    // Iterate over parameters and run tests
+    plasma_init();
+    if (inplace) {
+        plasma_set(PlasmaInplaceOutplace, PlasmaInplace);
+    }
+        do {
+            param_snap(param, pval);
+            for (int i = 0; i < iter; i++) {
+            err += test_routine(routine, pval, test);
+            }
+            if (iter > 1) {
+                printf("\n");
+            }
+        }
+    while (outer ? param_step_outer(param, 0) : param_step_inner(param));
+    plasma_finalize();
+    printf("\n");
+    return err;
+}
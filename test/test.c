@@ -17,13 +17,6 @@
 #include <stdbool.h>
 
 /******************************************************************************/
-typedef void (*test_func_ptr)(param_value_t param[], bool run);
-
-struct routines_t {
-    const char *name;
-    test_func_ptr func;
-};
-
 // To maintain 4 columns (z, d, s, c), each routine should have 4 entries;
 // use { "", NULL }  entries for missing precisions.
 struct routines_t routines[] =
@@ -83,11 +76,21 @@ struct routines_t routines[] =
     { "cgemm", test_cgemm },
     { "sgemm", test_sgemm },
 
+    { "zgemm_batch", test_zgemm_batch },
+    { "dgemm_batch", test_dgemm_batch },
+    { "cgemm_batch", test_cgemm_batch },
+    { "sgemm_batch", test_sgemm_batch },
+
     { "zgeqrf", test_zgeqrf },
     { "dgeqrf", test_dgeqrf },
     { "cgeqrf", test_cgeqrf },
     { "sgeqrf", test_sgeqrf },
 
+    { "zgeqrf_batch", test_zgeqrf_batch },
+    { "dgeqrf_batch", test_dgeqrf_batch },
+    { "cgeqrf_batch", test_cgeqrf_batch },
+    { "sgeqrf_batch", test_sgeqrf_batch },
+
     { "zgeqrs", test_zgeqrs },
     { "dgeqrs", test_dgeqrs },
     { "cgeqrs", test_cgeqrs },
@@ -113,6 +116,16 @@ struct routines_t routines[] =
     { "cgesv", test_cgesv },
     { "sgesv", test_sgesv },
 
+    { "zgesv_async", test_zgesv_async },
+    { "dgesv_async", test_dgesv_async },
+    { "cgesv_async", test_cgesv_async },
+    { "sgesv_async", test_sgesv_async },
+
+    { "zgesv_batch", test_zgesv_batch },
+    { "dgesv_batch", test_dgesv_batch },
+    { "cgesv_batch", test_cgesv_batch },
+    { "sgesv_batch", test_sgesv_batch },
+
     { "zgetrf", test_zgetrf },
     { "dgetrf", test_dgetrf },
     { "cgetrf", test_cgetrf },
@@ -133,6 +146,11 @@ struct routines_t routines[] =
     { "cgetrs", test_cgetrs },
     { "sgetrs", test_sgetrs },
 
+    { "zgetrs_handle", test_zgetrs_handle },
+    { "dgetrs_handle", test_dgetrs_handle },
+    { "cgetrs_handle", test_cgetrs_handle },
+    { "sgetrs_handle", test_sgetrs_handle },
+
     { "zhemm", test_zhemm },
     { "", NULL },
     { "chemm", test_chemm },
@@ -228,6 +246,16 @@ struct routines_t routines[] =
     { "cposv", test_cposv },
     { "sposv", test_sposv },
 
+    { "zposv_async", test_zposv_async },
+    { "dposv_async", test_dposv_async },
+    { "cposv_async", test_cposv_async },
+    { "sposv_async", test_sposv_async },
+
+    { "zposv_batch", test_zposv_batch },
+    { "dposv_batch", test_dposv_batch },
+    { "cposv_batch", test_cposv_batch },
+    { "sposv_batch", test_sposv_batch },
+
     { "zpoinv", test_zpoinv },
     { "dpoinv", test_dpoinv },
     { "cpoinv", test_cpoinv },
@@ -248,6 +276,11 @@ struct routines_t routines[] =
     { "cpotrs", test_cpotrs },
     { "spotrs", test_spotrs },
 
+    { "zpotrs_handle", test_zpotrs_handle },
+    { "dpotrs_handle", test_dpotrs_handle },
+    { "cpotrs_handle", test_cpotrs_handle },
+    { "spotrs_handle", test_spotrs_handle },
+
     { "", NULL },
     { "dstevx2", test_dstevx2 },
     { "", NULL },
@@ -367,6 +400,9 @@ static param_desc_t ParamDesc[] = {
     {"--tol=",             "tol",          0,     false,
      "tolerance [default: 50.0]"},
 
+    {"--inplace=[y|n]",    "inplace",      0,     false,
+     "translate between LAPACK and tile layouts in place [default: n]"},
+
     //------------------------------------------------------
     // function input parameters
     //------------------------------------------------------
@@ -464,76 +500,12 @@ static param_desc_t ParamDesc[] = {
     {"--incx=",            "incx",         4,     true,
      "1 to pivot forward, -1 to pivot backward [default: 1]"},
 
+    {"--batch=",           "batch",        5,     true,
+     "number of matrices of batched routines [default: 100]"},
+
     { NULL }  // last entry
 };
 
-/***************************************************************************//**
- *
- * @brief Tests and times a PLASMA routine.
- *        Prints usage information when ran without options.
- *
- * @param[in] argc
- * @param[in] argv
- *
- * @retval EXIT_SUCCESS - correct invocation
- * @retval EXIT_FAILURE - incorrect invocation
- * @retval > 0 - number of tests that failed
- *
- ******************************************************************************/
-int main(int argc, char **argv)
-{
-    if (argc == 1 ||
-        strcmp(argv[1], "-h") == 0 ||
-        strcmp(argv[1], "--help") == 0) {
-
-        print_main_usage(argv[0]);
-        return EXIT_SUCCESS;
-    }
-
-    if (strcmp(argv[1], "-v") == 0 ||
-        strcmp(argv[1], "--version") == 0) {
-        printf("PLASMA version %d.%d.%d\n",
-            PLASMA_VERSION_MAJOR, PLASMA_VERSION_MINOR, PLASMA_VERSION_PATCH);
-
-        return EXIT_SUCCESS;
-    }
-
-    const char *routine = argv[1];
-
-    // Ensure that ParamDesc has an entry for every param_label_t value.
-    assert(PARAM_SIZEOF == sizeof(ParamDesc)/sizeof(param_desc_t) - 1);
-
-    param_t param[PARAM_SIZEOF];      // set of parameters
-    param_value_t pval[PARAM_SIZEOF]; // snapshot of values
-
-    param_init(param);
-    param_read(argc, argv, param);
-    int  iter  = param[PARAM_ITER].val[0].i;
-    bool outer = param[PARAM_OUTER].val[0].c == 'y';
-    bool test  = param[PARAM_TEST].val[0].c == 'y';
-    int err = 0;
-
-    // Print labels.
-    param_snap(param, pval);
-    print_header(routine, pval);
-
-    // Iterate over parameters and run tests
-    plasma_init();
-        do {
-            param_snap(param, pval);
-            for (int i = 0; i < iter; i++) {
-            err += test_routine(routine, pval, test);
-            }
-            if (iter > 1) {
-                printf("\n");
-            }
-        }
-    while (outer ? param_step_outer(param, 0) : param_step_inner(param));
-    plasma_finalize();
-    printf("\n");
-    return err;
-}
-
 /***************************************************************************//**
  *
  * @brief Prints generic usage information.
@@ -584,6 +556,7 @@ void print_routine_usage(const char *program_name, const char *name, param_value
     print_usage(PARAM_DIM_OUTER);
     print_usage(PARAM_TEST);
     print_usage(PARAM_TOL);
+    print_usage(PARAM_INPLACE);
 
     printf("\n"
            "Options below accept multiple values separated by commas\n"
@@ -739,6 +712,7 @@ int test_routine(const char *name, param_value_t pval[], bool test)
             case PARAM_MTPF:
             case PARAM_ZEROCOL:
             case PARAM_INCX:
+            case PARAM_BATCH:
             case PARAM_ITERSV:
                 printf("  %*d", ParamDesc[i].width, pval[i].i);
                 break;
@@ -809,6 +783,9 @@ void run_routine(const char *name, param_value_t pval[], bool run)
  ******************************************************************************/
 void param_init(param_t param[])
 {
+    // Ensure that ParamDesc has an entry for every param_label_t value.
+    assert(PARAM_SIZEOF == sizeof(ParamDesc)/sizeof(param_desc_t) - 1);
+
     for (int i = 0; i < PARAM_SIZEOF; i++) {
         param[i].is_list = ParamDesc[i].is_list;
         param[i].num = 0;
@@ -845,6 +822,7 @@ void param_read(int argc, char **argv, param_t param[])
     param_add_char('n', &param[PARAM_DIM_OUTER]);
     param_add_char('y', &param[PARAM_TEST]);
     param_add_double(50.0, &param[PARAM_TOL]);
+    param_add_char('n', &param[PARAM_INPLACE]);
 
     //================================================================
     // Initialize parameters from the command line.
@@ -859,6 +837,8 @@ void param_read(int argc, char **argv, param_t param[])
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_DIM_OUTER]);
         else if (param_starts_with(argv[i], "--test="))
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_TEST]);
+        else if (param_starts_with(argv[i], "--inplace="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_INPLACE]);
 
         else if (param_starts_with(argv[i], "--side="))
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_SIDE]);
@@ -935,6 +915,8 @@ void param_read(int argc, char **argv, param_t param[])
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_ZEROCOL]);
         else if (param_starts_with(argv[i], "--incx="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_INCX]);
+        else if (param_starts_with(argv[i], "--batch="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_BATCH]);
 
         //--------------------------------------------------
         // Scan double precision parameters.
@@ -1035,6 +1017,8 @@ void param_read(int argc, char **argv, param_t param[])
         param_add_int(-1, &param[PARAM_ZEROCOL]);
     if (param[PARAM_INCX].num == 0)
         param_add_int(1, &param[PARAM_INCX]);
+    if (param[PARAM_BATCH].num == 0)
+        param_add_int(100, &param[PARAM_BATCH]);
 
     //--------------------------------------------------
     // Set double precision parameters.
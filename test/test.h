@@ -40,6 +40,7 @@ typedef enum {
     PARAM_DIM_OUTER, // outer product iteration for dimensions M, N, K?
     PARAM_TEST,    // test the solution?
     PARAM_TOL,     // tolerance
+    PARAM_INPLACE, // translate layouts in place?
 
     //------------------------------------------------------
     // function input parameters
@@ -78,6 +79,7 @@ typedef enum {
     PARAM_MTPF,    // maximum number of threads for panel factorization
     PARAM_ZEROCOL, // if positive, a column of zeros inserted at that index
     PARAM_INCX,    // 1 to pivot forward, -1 to pivot backward
+    PARAM_BATCH,   // number of matrices of batched routines
 
     //------------------------------------------------------
     // Keep at the end!
@@ -134,6 +136,17 @@ static const int InfoLen = 1024;
 // each column is InfoSpacing wide + 1 space between columns
 static const int InfoSpacing = 11;
 
+// routine of the tester
+typedef void (*test_func_ptr)(param_value_t param[], bool run);
+
+struct routines_t {
+    const char *name;
+    test_func_ptr func;
+};
+
+// routines of the tester, ending with a NULL entry
+extern struct routines_t routines[];
+
 // function declarations
 void print_main_usage(const char *program_name);
 void print_routine_usage(const char *program_name, const char *name, param_value_t pval[]);
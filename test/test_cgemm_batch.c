@@ -0,0 +1,270 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgemm_batch.c, normal z -> c, Sat Oct 17 13:40:27 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "plasma.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests CGEMM_BATCH and its variable size version, multiplying
+ *        batch matrices of sizes m, n, k and of sizes up to m, n, k
+ *        stored at strides of lda*An, ldb*Bn and ldc*n.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_cgemm_batch(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_TRANSA].used = true;
+    param[PARAM_TRANSB].used = true;
+    param[PARAM_DIM   ].used = PARAM_USE_M | PARAM_USE_N | PARAM_USE_K;
+    param[PARAM_ALPHA ].used = true;
+    param[PARAM_BETA  ].used = true;
+    param[PARAM_PADA  ].used = true;
+    param[PARAM_PADB  ].used = true;
+    param[PARAM_PADC  ].used = true;
+    param[PARAM_BATCH ].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t transa = plasma_trans_const(param[PARAM_TRANSA].c);
+    plasma_enum_t transb = plasma_trans_const(param[PARAM_TRANSB].c);
+
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int k = param[PARAM_DIM].dim.k;
+    int batch = param[PARAM_BATCH].i;
+
+    int Am = transa == PlasmaNoTrans ? m : k;
+    int An = transa == PlasmaNoTrans ? k : m;
+    int Bm = transb == PlasmaNoTrans ? k : n;
+    int Bn = transb == PlasmaNoTrans ? n : k;
+
+    int lda = imax(1, Am + param[PARAM_PADA].i);
+    int ldb = imax(1, Bm + param[PARAM_PADB].i);
+    int ldc = imax(1, m + param[PARAM_PADC].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float eps = LAPACKE_slamch('E');
+
+#ifdef COMPLEX
+    plasma_complex32_t alpha = param[PARAM_ALPHA].z;
+    plasma_complex32_t beta  = param[PARAM_BETA].z;
+#else
+    float alpha = creal(param[PARAM_ALPHA].z);
+    float beta  = creal(param[PARAM_BETA].z);
+#endif
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    size_t sizeA = (size_t)lda*An;
+    size_t sizeB = (size_t)ldb*Bn;
+    size_t sizeC = (size_t)ldc*n;
+
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc(batch*sizeA*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    plasma_complex32_t *B =
+        (plasma_complex32_t*)malloc(batch*sizeB*sizeof(plasma_complex32_t));
+    assert(B != NULL);
+
+    plasma_complex32_t *C =
+        (plasma_complex32_t*)malloc(batch*sizeC*sizeof(plasma_complex32_t));
+    assert(C != NULL);
+
+    plasma_complex32_t **pA =
+        (plasma_complex32_t**)malloc(batch*sizeof(plasma_complex32_t*));
+    assert(pA != NULL);
+
+    plasma_complex32_t **pB =
+        (plasma_complex32_t**)malloc(batch*sizeof(plasma_complex32_t*));
+    assert(pB != NULL);
+
+    plasma_complex32_t **pC =
+        (plasma_complex32_t**)malloc(batch*sizeof(plasma_complex32_t*));
+    assert(pC != NULL);
+
+    int *ms = (int*)malloc(batch*sizeof(int));
+    assert(ms != NULL);
+
+    int *ns = (int*)malloc(batch*sizeof(int));
+    assert(ns != NULL);
+
+    int *ks = (int*)malloc(batch*sizeof(int));
+    assert(ks != NULL);
+
+    int *ldas = (int*)malloc(batch*sizeof(int));
+    assert(ldas != NULL);
+
+    int *ldbs = (int*)malloc(batch*sizeof(int));
+    assert(ldbs != NULL);
+
+    int *ldcs = (int*)malloc(batch*sizeof(int));
+    assert(ldcs != NULL);
+
+    plasma_complex32_t *Cref = NULL;
+    if (test) {
+        Cref = (plasma_complex32_t*)malloc(
+            batch*sizeC*sizeof(plasma_complex32_t));
+        assert(Cref != NULL);
+    }
+
+    for (int i = 0; i < batch; i++) {
+        pA[i] = &A[i*sizeA];
+        pB[i] = &B[i*sizeB];
+        pC[i] = &C[i*sizeC];
+        // sizes of the variable size batch, up to m, n, k
+        ms[i] = m > 0 ? 1 + (i*37) % m : 0;
+        ns[i] = n > 0 ? 1 + (i*53) % n : 0;
+        ks[i] = k > 0 ? 1 + (i*71) % k : 0;
+        ldas[i] = lda;
+        ldbs[i] = ldb;
+        ldcs[i] = ldc;
+    }
+
+    //================================================================
+    // Run the batch of the same size, then the batch of different
+    // sizes, on the same data.
+    //================================================================
+    param[PARAM_ERROR].d = 0.0;
+    param[PARAM_SUCCESS].i = 1;
+    for (int vbatch = 0; vbatch <= 1; vbatch++) {
+        int seed[] = {0, 0, 0, 1};
+        lapack_int retval;
+        retval = LAPACKE_clarnv(1, seed, batch*sizeA, A);
+        assert(retval == 0);
+        retval = LAPACKE_clarnv(1, seed, batch*sizeB, B);
+        assert(retval == 0);
+        retval = LAPACKE_clarnv(1, seed, batch*sizeC, C);
+        assert(retval == 0);
+
+        if (test)
+            memcpy(Cref, C, batch*sizeC*sizeof(plasma_complex32_t));
+
+        //============================================================
+        // Run and time PLASMA.
+        //============================================================
+        plasma_time_t start = omp_get_wtime();
+        if (vbatch) {
+            plasma_cgemm_vbatch(transa, transb, ms, ns, ks,
+                                alpha, pA, ldas,
+                                       pB, ldbs,
+                                beta,  pC, ldcs, batch);
+        }
+        else {
+            plasma_cgemm_batch(transa, transb, m, n, k,
+                               alpha, pA, lda,
+                                      pB, ldb,
+                               beta,  pC, ldc, batch);
+        }
+        plasma_time_t stop = omp_get_wtime();
+
+        if (! vbatch) {
+            plasma_time_t time = stop-start;
+            param[PARAM_TIME].d = time;
+            param[PARAM_GFLOPS].d = batch*flops_cgemm(m, n, k) / time / 1e9;
+        }
+
+        //============================================================
+        // Test results by comparing to a reference implementation,
+        // with the bound of test_cgemm.
+        //============================================================
+        if (test) {
+            plasma_complex32_t zmone = -1.0;
+            float work[1];
+
+            for (int b = 0; b < batch; b++) {
+                int mb = vbatch ? ms[b] : m;
+                int nb = vbatch ? ns[b] : n;
+                int kb = vbatch ? ks[b] : k;
+                int Amb = transa == PlasmaNoTrans ? mb : kb;
+                int Anb = transa == PlasmaNoTrans ? kb : mb;
+                int Bmb = transb == PlasmaNoTrans ? kb : nb;
+                int Bnb = transb == PlasmaNoTrans ? nb : kb;
+
+                plasma_complex32_t *Cb = &Cref[b*sizeC];
+                float Anorm = LAPACKE_clange_work(
+                    LAPACK_COL_MAJOR, 'F', Amb, Anb, pA[b], lda, work);
+                float Bnorm = LAPACKE_clange_work(
+                    LAPACK_COL_MAJOR, 'F', Bmb, Bnb, pB[b], ldb, work);
+                float Cnorm = LAPACKE_clange_work(
+                    LAPACK_COL_MAJOR, 'F', mb, nb, Cb, ldc, work);
+
+                cblas_cgemm(
+                    CblasColMajor,
+                    (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                    mb, nb, kb,
+                    CBLAS_SADDR(alpha), pA[b], lda,
+                                        pB[b], ldb,
+                     CBLAS_SADDR(beta), Cb, ldc);
+
+                for (int j = 0; j < nb; j++)
+                    cblas_caxpy(mb, CBLAS_SADDR(zmone),
+                                &Cb[(size_t)ldc*j], 1,
+                                &pC[b][(size_t)ldc*j], 1);
+
+                float error = LAPACKE_clange_work(
+                    LAPACK_COL_MAJOR, 'F', mb, nb, pC[b], ldc, work);
+                float normalize = sqrtf((float)kb+2) * cabsf(alpha)
+                                 * Anorm * Bnorm
+                                 + 2 * cabsf(beta) * Cnorm;
+                if (normalize != 0)
+                    error /= normalize;
+
+                param[PARAM_ERROR].d = fmax(param[PARAM_ERROR].d, error);
+                param[PARAM_SUCCESS].i &= error < 3*eps;
+            }
+        }
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(B);
+    free(C);
+    free(pA);
+    free(pB);
+    free(pC);
+    free(ms);
+    free(ns);
+    free(ks);
+    free(ldas);
+    free(ldbs);
+    free(ldcs);
+    if (test)
+        free(Cref);
+}
@@ -0,0 +1,244 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgesv_batch.c, normal z -> c, Sat Oct 17 13:40:26 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "plasma.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests CGETRF_BATCH and CGETRS_BATCH, and their variable size
+ *        versions, solving batch systems of order n and of orders
+ *        up to n stored at a stride of lda*n.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_cgesv_batch(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_DIM  ].used = PARAM_USE_N;
+    param[PARAM_NRHS ].used = true;
+    param[PARAM_PADA ].used = true;
+    param[PARAM_PADB ].used = true;
+    param[PARAM_BATCH].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int n = param[PARAM_DIM].dim.n;
+    int nrhs = param[PARAM_NRHS].i;
+    int batch = param[PARAM_BATCH].i;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+    int ldb = imax(1, n + param[PARAM_PADB].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    size_t sizeA = (size_t)lda*n;
+    size_t sizeB = (size_t)ldb*nrhs;
+
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc(batch*sizeA*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    plasma_complex32_t *B =
+        (plasma_complex32_t*)malloc(batch*sizeB*sizeof(plasma_complex32_t));
+    assert(B != NULL);
+
+    int *ipiv = (int*)malloc((size_t)batch*imax(1, n)*sizeof(int));
+    assert(ipiv != NULL);
+
+    plasma_complex32_t **pA =
+        (plasma_complex32_t**)malloc(batch*sizeof(plasma_complex32_t*));
+    assert(pA != NULL);
+
+    plasma_complex32_t **pB =
+        (plasma_complex32_t**)malloc(batch*sizeof(plasma_complex32_t*));
+    assert(pB != NULL);
+
+    int **pipiv = (int**)malloc(batch*sizeof(int*));
+    assert(pipiv != NULL);
+
+    int *ns = (int*)malloc(batch*sizeof(int));
+    assert(ns != NULL);
+
+    int *nrhss = (int*)malloc(batch*sizeof(int));
+    assert(nrhss != NULL);
+
+    int *ldas = (int*)malloc(batch*sizeof(int));
+    assert(ldas != NULL);
+
+    int *ldbs = (int*)malloc(batch*sizeof(int));
+    assert(ldbs != NULL);
+
+    int *info = (int*)malloc(batch*sizeof(int));
+    assert(info != NULL);
+
+    plasma_complex32_t *Aref = NULL;
+    plasma_complex32_t *Bref = NULL;
+    float *work = NULL;
+    if (test) {
+        Aref = (plasma_complex32_t*)malloc(
+            batch*sizeA*sizeof(plasma_complex32_t));
+        assert(Aref != NULL);
+
+        Bref = (plasma_complex32_t*)malloc(
+            batch*sizeB*sizeof(plasma_complex32_t));
+        assert(Bref != NULL);
+
+        work = (float*)malloc((size_t)imax(1, n)*sizeof(float));
+        assert(work != NULL);
+    }
+
+    for (int i = 0; i < batch; i++) {
+        pA[i] = &A[i*sizeA];
+        pB[i] = &B[i*sizeB];
+        pipiv[i] = &ipiv[(size_t)i*imax(1, n)];
+        // orders of the variable size batch, up to n
+        ns[i] = n > 0 ? 1 + (i*37) % n : 0;
+        nrhss[i] = nrhs;
+        ldas[i] = lda;
+        ldbs[i] = ldb;
+    }
+
+    //================================================================
+    // Run the batch of the same size, then the batch of different
+    // sizes, on the same data.
+    //================================================================
+    param[PARAM_ERROR].d = 0.0;
+    param[PARAM_SUCCESS].i = 1;
+    for (int vbatch = 0; vbatch <= 1; vbatch++) {
+        int seed[] = {0, 0, 0, 1};
+        lapack_int retval;
+        retval = LAPACKE_clarnv(1, seed, batch*sizeA, A);
+        assert(retval == 0);
+        retval = LAPACKE_clarnv(1, seed, batch*sizeB, B);
+        assert(retval == 0);
+
+        if (test) {
+            memcpy(Aref, A, batch*sizeA*sizeof(plasma_complex32_t));
+            memcpy(Bref, B, batch*sizeB*sizeof(plasma_complex32_t));
+        }
+
+        //============================================================
+        // Run and time PLASMA.
+        //============================================================
+        plasma_time_t start = omp_get_wtime();
+        if (vbatch) {
+            plasma_cgetrf_vbatch(ns, ns, pA, ldas, pipiv, batch, info);
+            plasma_cgetrs_vbatch(ns, nrhss, pA, ldas, pipiv, pB, ldbs, batch);
+        }
+        else {
+            plasma_cgetrf_batch(n, n, pA, lda, pipiv, batch, info);
+            plasma_cgetrs_batch(n, nrhs, pA, lda, pipiv, pB, ldb, batch);
+        }
+        plasma_time_t stop = omp_get_wtime();
+
+        if (! vbatch) {
+            plasma_time_t time = stop-start;
+            float flops = batch*(flops_cgetrf(n, n) + flops_cgetrs(n, nrhs));
+            param[PARAM_TIME].d = time;
+            param[PARAM_GFLOPS].d = flops / time / 1e9;
+        }
+
+        //============================================================
+        // Test results by checking the residuals
+        //
+        //                      || B - AX ||_I
+        //                --------------------------- < epsilon
+        //                 || A ||_I * || X ||_I * N
+        //
+        //============================================================
+        if (test) {
+            plasma_complex32_t zone  =  1.0;
+            plasma_complex32_t zmone = -1.0;
+
+            for (int b = 0; b < batch; b++) {
+                int nb = vbatch ? ns[b] : n;
+                if (info[b] != 0) {
+                    param[PARAM_ERROR].d = INFINITY;
+                    param[PARAM_SUCCESS].i = 0;
+                    continue;
+                }
+                if (nb == 0 || nrhs == 0)
+                    continue;
+
+                plasma_complex32_t *Ab = &Aref[b*sizeA];
+                plasma_complex32_t *Bb = &Bref[b*sizeB];
+                plasma_complex32_t *Xb = pB[b];
+
+                float Anorm = LAPACKE_clange_work(
+                    LAPACK_COL_MAJOR, 'I', nb, nb, Ab, lda, work);
+                float Xnorm = LAPACKE_clange_work(
+                    LAPACK_COL_MAJOR, 'I', nb, nrhs, Xb, ldb, work);
+
+                // Bb -= Ab*Xb
+                cblas_cgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                            nb, nrhs, nb,
+                            CBLAS_SADDR(zmone), Ab, lda,
+                                                Xb, ldb,
+                            CBLAS_SADDR(zone),  Bb, ldb);
+
+                float Rnorm = LAPACKE_clange_work(
+                    LAPACK_COL_MAJOR, 'I', nb, nrhs, Bb, ldb, work);
+                float residual = Rnorm/(nb*Anorm*Xnorm);
+
+                param[PARAM_ERROR].d = fmax(param[PARAM_ERROR].d, residual);
+                param[PARAM_SUCCESS].i &= residual < tol;
+            }
+        }
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(B);
+    free(ipiv);
+    free(pA);
+    free(pB);
+    free(pipiv);
+    free(ns);
+    free(nrhss);
+    free(ldas);
+    free(ldbs);
+    free(info);
+    if (test) {
+        free(Aref);
+        free(Bref);
+        free(work);
+    }
+}
@@ -0,0 +1,250 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zposv_batch.c, normal z -> c, Sat Oct 17 13:40:26 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "plasma.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests CPOTRF_BATCH and CPOTRS_BATCH, and their variable size
+ *        versions, solving batch systems of order n and of orders
+ *        up to n stored at a stride of lda*n.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_cposv_batch(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_UPLO ].used = true;
+    param[PARAM_DIM  ].used = PARAM_USE_N;
+    param[PARAM_NRHS ].used = true;
+    param[PARAM_PADA ].used = true;
+    param[PARAM_PADB ].used = true;
+    param[PARAM_BATCH].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+
+    int n = param[PARAM_DIM].dim.n;
+    int nrhs = param[PARAM_NRHS].i;
+    int batch = param[PARAM_BATCH].i;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+    int ldb = imax(1, n + param[PARAM_PADB].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    size_t sizeA = (size_t)lda*n;
+    size_t sizeB = (size_t)ldb*nrhs;
+
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc(batch*sizeA*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    plasma_complex32_t *B =
+        (plasma_complex32_t*)malloc(batch*sizeB*sizeof(plasma_complex32_t));
+    assert(B != NULL);
+
+    plasma_complex32_t **pA =
+        (plasma_complex32_t**)malloc(batch*sizeof(plasma_complex32_t*));
+    assert(pA != NULL);
+
+    plasma_complex32_t **pB =
+        (plasma_complex32_t**)malloc(batch*sizeof(plasma_complex32_t*));
+    assert(pB != NULL);
+
+    int *ns = (int*)malloc(batch*sizeof(int));
+    assert(ns != NULL);
+
+    int *nrhss = (int*)malloc(batch*sizeof(int));
+    assert(nrhss != NULL);
+
+    int *ldas = (int*)malloc(batch*sizeof(int));
+    assert(ldas != NULL);
+
+    int *ldbs = (int*)malloc(batch*sizeof(int));
+    assert(ldbs != NULL);
+
+    int *info = (int*)malloc(batch*sizeof(int));
+    assert(info != NULL);
+
+    plasma_complex32_t *Aref = NULL;
+    plasma_complex32_t *Bref = NULL;
+    float *work = NULL;
+    if (test) {
+        Aref = (plasma_complex32_t*)malloc(
+            batch*sizeA*sizeof(plasma_complex32_t));
+        assert(Aref != NULL);
+
+        Bref = (plasma_complex32_t*)malloc(
+            batch*sizeB*sizeof(plasma_complex32_t));
+        assert(Bref != NULL);
+
+        work = (float*)malloc((size_t)imax(1, n)*sizeof(float));
+        assert(work != NULL);
+    }
+
+    for (int i = 0; i < batch; i++) {
+        pA[i] = &A[i*sizeA];
+        pB[i] = &B[i*sizeB];
+        // orders of the variable size batch, up to n
+        ns[i] = n > 0 ? 1 + (i*37) % n : 0;
+        nrhss[i] = nrhs;
+        ldas[i] = lda;
+        ldbs[i] = ldb;
+    }
+
+    //================================================================
+    // Run the batch of the same size, then the batch of different
+    // sizes, on the same data.
+    //================================================================
+    param[PARAM_ERROR].d = 0.0;
+    param[PARAM_SUCCESS].i = 1;
+    for (int vbatch = 0; vbatch <= 1; vbatch++) {
+        int seed[] = {0, 0, 0, 1};
+        lapack_int retval;
+        retval = LAPACKE_clarnv(1, seed, batch*sizeA, A);
+        assert(retval == 0);
+        retval = LAPACKE_clarnv(1, seed, batch*sizeB, B);
+        assert(retval == 0);
+
+        // Make the matrices Hermitian positive definite.
+        for (int b = 0; b < batch; b++) {
+            int nb = vbatch ? ns[b] : n;
+            plasma_complex32_t *Ab = pA[b];
+            for (int i = 0; i < nb; i++) {
+                Ab[i+(size_t)lda*i] = creal(Ab[i+(size_t)lda*i]) + nb;
+                for (int j = 0; j < i; j++)
+                    Ab[j+(size_t)lda*i] = conjf(Ab[i+(size_t)lda*j]);
+            }
+        }
+
+        if (test) {
+            memcpy(Aref, A, batch*sizeA*sizeof(plasma_complex32_t));
+            memcpy(Bref, B, batch*sizeB*sizeof(plasma_complex32_t));
+        }
+
+        //============================================================
+        // Run and time PLASMA.
+        //============================================================
+        plasma_time_t start = omp_get_wtime();
+        if (vbatch) {
+            plasma_cpotrf_vbatch(uplo, ns, pA, ldas, batch, info);
+            plasma_cpotrs_vbatch(uplo, ns, nrhss, pA, ldas, pB, ldbs, batch);
+        }
+        else {
+            plasma_cpotrf_batch(uplo, n, pA, lda, batch, info);
+            plasma_cpotrs_batch(uplo, n, nrhs, pA, lda, pB, ldb, batch);
+        }
+        plasma_time_t stop = omp_get_wtime();
+
+        if (! vbatch) {
+            plasma_time_t time = stop-start;
+            float flops = batch*(flops_cpotrf(n) + flops_cpotrs(n, nrhs));
+            param[PARAM_TIME].d = time;
+            param[PARAM_GFLOPS].d = flops / time / 1e9;
+        }
+
+        //============================================================
+        // Test results by checking the residuals
+        //
+        //                      || B - AX ||_I
+        //                --------------------------- < epsilon
+        //                 || A ||_I * || X ||_I * N
+        //
+        //============================================================
+        if (test) {
+            plasma_complex32_t zone  =  1.0;
+            plasma_complex32_t zmone = -1.0;
+
+            for (int b = 0; b < batch; b++) {
+                int nb = vbatch ? ns[b] : n;
+                if (info[b] != 0) {
+                    param[PARAM_ERROR].d = INFINITY;
+                    param[PARAM_SUCCESS].i = 0;
+                    continue;
+                }
+                if (nb == 0 || nrhs == 0)
+                    continue;
+
+                plasma_complex32_t *Ab = &Aref[b*sizeA];
+                plasma_complex32_t *Bb = &Bref[b*sizeB];
+                plasma_complex32_t *Xb = pB[b];
+
+                float Anorm = LAPACKE_clanhe_work(
+                    LAPACK_COL_MAJOR, 'I', lapack_const(uplo), nb,
+                    Ab, lda, work);
+                float Xnorm = LAPACKE_clange_work(
+                    LAPACK_COL_MAJOR, 'I', nb, nrhs, Xb, ldb, work);
+
+                // Bb -= Ab*Xb
+                cblas_chemm(CblasColMajor, CblasLeft, (CBLAS_UPLO)uplo,
+                            nb, nrhs,
+                            CBLAS_SADDR(zmone), Ab, lda,
+                                                Xb, ldb,
+                            CBLAS_SADDR(zone),  Bb, ldb);
+
+                float Rnorm = LAPACKE_clange_work(
+                    LAPACK_COL_MAJOR, 'I', nb, nrhs, Bb, ldb, work);
+                float residual = Rnorm/(nb*Anorm*Xnorm);
+
+                param[PARAM_ERROR].d = fmax(param[PARAM_ERROR].d, residual);
+                param[PARAM_SUCCESS].i &= residual < tol;
+            }
+        }
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(B);
+    free(pA);
+    free(pB);
+    free(ns);
+    free(nrhss);
+    free(ldas);
+    free(ldbs);
+    free(info);
+    if (test) {
+        free(Aref);
+        free(Bref);
+        free(work);
+    }
+}
@@ -0,0 +1,80 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_z.h, normal z -> d, Sat Oct 17 13:40:03 2026
+ *
+ **/
+#ifndef TEST_D_H
+#define TEST_D_H
+
+#include "test.h"
+
+//==============================================================================
+// test routines
+//==============================================================================
+void test_damax(param_value_t param[], bool run);
+void test_dgbmm(param_value_t param[], bool run);
+void test_dgbsv(param_value_t param[], bool run);
+void test_dgbtrf(param_value_t param[], bool run);
+void test_dgeadd(param_value_t param[], bool run);
+void test_dgeinv(param_value_t param[], bool run);
+void test_dgelqf(param_value_t param[], bool run);
+void test_dgelqs(param_value_t param[], bool run);
+void test_dgels(param_value_t param[], bool run);
+void test_dgemm(param_value_t param[], bool run);
+void test_dgemm_batch(param_value_t param[], bool run);
+void test_dgeqrf(param_value_t param[], bool run);
+void test_dgeqrf_batch(param_value_t param[], bool run);
+void test_dgeqrs(param_value_t param[], bool run);
+void test_dgesdd(param_value_t param[], bool run);
+void test_dgesv(param_value_t param[], bool run);
+void test_dgesv_async(param_value_t param[], bool run);
+void test_dgesv_batch(param_value_t param[], bool run);
+void test_dgetrf(param_value_t param[], bool run);
+void test_dgetri(param_value_t param[], bool run);
+void test_dgetri_aux(param_value_t param[], bool run);
+void test_dgetrs(param_value_t param[], bool run);
+void test_dgetrs_handle(param_value_t param[], bool run);
+void test_dsymm(param_value_t param[], bool run);
+void test_dsyr2k(param_value_t param[], bool run);
+void test_dsyrk(param_value_t param[], bool run);
+void test_dsytrf(param_value_t param[], bool run);
+void test_dsysv(param_value_t param[], bool run);
+void test_dlacpy(param_value_t param[], bool run);
+void test_dlag2s(param_value_t param[], bool run);
+void test_dlange(param_value_t param[], bool run);
+void test_dlangb(param_value_t param[], bool run);
+void test_dlansy(param_value_t param[], bool run);
+void test_dlansy(param_value_t param[], bool run);
+void test_dlantr(param_value_t param[], bool run);
+void test_dlascl(param_value_t param[], bool run);
+void test_dlaset(param_value_t param[], bool run);
+void test_dgeswp(param_value_t param[], bool run);
+void test_dlauum(param_value_t param[], bool run);
+void test_dpbsv(param_value_t param[], bool run);
+void test_dpbtrf(param_value_t param[], bool run);
+void test_dpoinv(param_value_t param[], bool run);
+void test_dposv(param_value_t param[], bool run);
+void test_dposv_async(param_value_t param[], bool run);
+void test_dposv_batch(param_value_t param[], bool run);
+void test_dpotrf(param_value_t param[], bool run);
+void test_dpotri(param_value_t param[], bool run);
+void test_dpotrs(param_value_t param[], bool run);
+void test_dpotrs_handle(param_value_t param[], bool run);
+void test_dsymm(param_value_t param[], bool run);
+void test_dstevx2(param_value_t param[], bool run);
+void test_dsyr2k(param_value_t param[], bool run);
+void test_dsyrk(param_value_t param[], bool run);
+void test_dtradd(param_value_t param[], bool run);
+void test_dtrmm(param_value_t param[], bool run);
+void test_dtrsm(param_value_t param[], bool run);
+void test_dtrtri(param_value_t param[], bool run);
+void test_dormlq(param_value_t param[], bool run);
+void test_dormqr(param_value_t param[], bool run);
+
+#endif // TEST_D_H
@@ -0,0 +1,250 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zposv_batch.c, normal z -> d, Sat Oct 17 13:40:26 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "plasma.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests DPOTRF_BATCH and DPOTRS_BATCH, and their variable size
+ *        versions, solving batch systems of order n and of orders
+ *        up to n stored at a stride of lda*n.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_dposv_batch(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_UPLO ].used = true;
+    param[PARAM_DIM  ].used = PARAM_USE_N;
+    param[PARAM_NRHS ].used = true;
+    param[PARAM_PADA ].used = true;
+    param[PARAM_PADB ].used = true;
+    param[PARAM_BATCH].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+
+    int n = param[PARAM_DIM].dim.n;
+    int nrhs = param[PARAM_NRHS].i;
+    int batch = param[PARAM_BATCH].i;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+    int ldb = imax(1, n + param[PARAM_PADB].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    size_t sizeA = (size_t)lda*n;
+    size_t sizeB = (size_t)ldb*nrhs;
+
+    double *A =
+        (double*)malloc(batch*sizeA*sizeof(double));
+    assert(A != NULL);
+
+    double *B =
+        (double*)malloc(batch*sizeB*sizeof(double));
+    assert(B != NULL);
+
+    double **pA =
+        (double**)malloc(batch*sizeof(double*));
+    assert(pA != NULL);
+
+    double **pB =
+        (double**)malloc(batch*sizeof(double*));
+    assert(pB != NULL);
+
+    int *ns = (int*)malloc(batch*sizeof(int));
+    assert(ns != NULL);
+
+    int *nrhss = (int*)malloc(batch*sizeof(int));
+    assert(nrhss != NULL);
+
+    int *ldas = (int*)malloc(batch*sizeof(int));
+    assert(ldas != NULL);
+
+    int *ldbs = (int*)malloc(batch*sizeof(int));
+    assert(ldbs != NULL);
+
+    int *info = (int*)malloc(batch*sizeof(int));
+    assert(info != NULL);
+
+    double *Aref = NULL;
+    double *Bref = NULL;
+    double *work = NULL;
+    if (test) {
+        Aref = (double*)malloc(
+            batch*sizeA*sizeof(double));
+        assert(Aref != NULL);
+
+        Bref = (double*)malloc(
+            batch*sizeB*sizeof(double));
+        assert(Bref != NULL);
+
+        work = (double*)malloc((size_t)imax(1, n)*sizeof(double));
+        assert(work != NULL);
+    }
+
+    for (int i = 0; i < batch; i++) {
+        pA[i] = &A[i*sizeA];
+        pB[i] = &B[i*sizeB];
+        // orders of the variable size batch, up to n
+        ns[i] = n > 0 ? 1 + (i*37) % n : 0;
+        nrhss[i] = nrhs;
+        ldas[i] = lda;
+        ldbs[i] = ldb;
+    }
+
+    //================================================================
+    // Run the batch of the same size, then the batch of different
+    // sizes, on the same data.
+    //================================================================
+    param[PARAM_ERROR].d = 0.0;
+    param[PARAM_SUCCESS].i = 1;
+    for (int vbatch = 0; vbatch <= 1; vbatch++) {
+        int seed[] = {0, 0, 0, 1};
+        lapack_int retval;
+        retval = LAPACKE_dlarnv(1, seed, batch*sizeA, A);
+        assert(retval == 0);
+        retval = LAPACKE_dlarnv(1, seed, batch*sizeB, B);
+        assert(retval == 0);
+
+        // Make the matrices symmetric positive definite.
+        for (int b = 0; b < batch; b++) {
+            int nb = vbatch ? ns[b] : n;
+            double *Ab = pA[b];
+            for (int i = 0; i < nb; i++) {
+                Ab[i+(size_t)lda*i] = creal(Ab[i+(size_t)lda*i]) + nb;
+                for (int j = 0; j < i; j++)
+                    Ab[j+(size_t)lda*i] = (Ab[i+(size_t)lda*j]);
+            }
+        }
+
+        if (test) {
+            memcpy(Aref, A, batch*sizeA*sizeof(double));
+            memcpy(Bref, B, batch*sizeB*sizeof(double));
+        }
+
+        //============================================================
+        // Run and time PLASMA.
+        //============================================================
+        plasma_time_t start = omp_get_wtime();
+        if (vbatch) {
+            plasma_dpotrf_vbatch(uplo, ns, pA, ldas, batch, info);
+            plasma_dpotrs_vbatch(uplo, ns, nrhss, pA, ldas, pB, ldbs, batch);
+        }
+        else {
+            plasma_dpotrf_batch(uplo, n, pA, lda, batch, info);
+            plasma_dpotrs_batch(uplo, n, nrhs, pA, lda, pB, ldb, batch);
+        }
+        plasma_time_t stop = omp_get_wtime();
+
+        if (! vbatch) {
+            plasma_time_t time = stop-start;
+            double flops = batch*(flops_dpotrf(n) + flops_dpotrs(n, nrhs));
+            param[PARAM_TIME].d = time;
+            param[PARAM_GFLOPS].d = flops / time / 1e9;
+        }
+
+        //============================================================
+        // Test results by checking the residuals
+        //
+        //                      || B - AX ||_I
+        //                --------------------------- < epsilon
+        //                 || A ||_I * || X ||_I * N
+        //
+        //============================================================
+        if (test) {
+            double zone  =  1.0;
+            double zmone = -1.0;
+
+            for (int b = 0; b < batch; b++) {
+                int nb = vbatch ? ns[b] : n;
+                if (info[b] != 0) {
+                    param[PARAM_ERROR].d = INFINITY;
+                    param[PARAM_SUCCESS].i = 0;
+                    continue;
+                }
+                if (nb == 0 || nrhs == 0)
+                    continue;
+
+                double *Ab = &Aref[b*sizeA];
+                double *Bb = &Bref[b*sizeB];
+                double *Xb = pB[b];
+
+                double Anorm = LAPACKE_dlansy_work(
+                    LAPACK_COL_MAJOR, 'I', lapack_const(uplo), nb,
+                    Ab, lda, work);
+                double Xnorm = LAPACKE_dlange_work(
+                    LAPACK_COL_MAJOR, 'I', nb, nrhs, Xb, ldb, work);
+
+                // Bb -= Ab*Xb
+                cblas_dsymm(CblasColMajor, CblasLeft, (CBLAS_UPLO)uplo,
+                            nb, nrhs,
+                            (zmone), Ab, lda,
+                                                Xb, ldb,
+                            (zone),  Bb, ldb);
+
+                double Rnorm = LAPACKE_dlange_work(
+                    LAPACK_COL_MAJOR, 'I', nb, nrhs, Bb, ldb, work);
+                double residual = Rnorm/(nb*Anorm*Xnorm);
+
+                param[PARAM_ERROR].d = fmax(param[PARAM_ERROR].d, residual);
+                param[PARAM_SUCCESS].i &= residual < tol;
+            }
+        }
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(B);
+    free(pA);
+    free(pB);
+    free(ns);
+    free(nrhss);
+    free(ldas);
+    free(ldbs);
+    free(info);
+    if (test) {
+        free(Aref);
+        free(Bref);
+        free(work);
+    }
+}
@@ -0,0 +1,80 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_z.h, normal z -> s, Sat Oct 17 13:40:03 2026
+ *
+ **/
+#ifndef TEST_S_H
+#define TEST_S_H
+
+#include "test.h"
+
+//==============================================================================
+// test routines
+//==============================================================================
+void test_samax(param_value_t param[], bool run);
+void test_sgbmm(param_value_t param[], bool run);
+void test_sgbsv(param_value_t param[], bool run);
+void test_sgbtrf(param_value_t param[], bool run);
+void test_sgeadd(param_value_t param[], bool run);
+void test_sgeinv(param_value_t param[], bool run);
+void test_sgelqf(param_value_t param[], bool run);
+void test_sgelqs(param_value_t param[], bool run);
+void test_sgels(param_value_t param[], bool run);
+void test_sgemm(param_value_t param[], bool run);
+void test_sgemm_batch(param_value_t param[], bool run);
+void test_sgeqrf(param_value_t param[], bool run);
+void test_sgeqrf_batch(param_value_t param[], bool run);
+void test_sgeqrs(param_value_t param[], bool run);
+void test_sgesdd(param_value_t param[], bool run);
+void test_sgesv(param_value_t param[], bool run);
+void test_sgesv_async(param_value_t param[], bool run);
+void test_sgesv_batch(param_value_t param[], bool run);
+void test_sgetrf(param_value_t param[], bool run);
+void test_sgetri(param_value_t param[], bool run);
+void test_sgetri_aux(param_value_t param[], bool run);
+void test_sgetrs(param_value_t param[], bool run);
+void test_sgetrs_handle(param_value_t param[], bool run);
+void test_ssymm(param_value_t param[], bool run);
+void test_ssyr2k(param_value_t param[], bool run);
+void test_ssyrk(param_value_t param[], bool run);
+void test_ssytrf(param_value_t param[], bool run);
+void test_ssysv(param_value_t param[], bool run);
+void test_slacpy(param_value_t param[], bool run);
+void test_slag2d(param_value_t param[], bool run);
+void test_slange(param_value_t param[], bool run);
+void test_slangb(param_value_t param[], bool run);
+void test_slansy(param_value_t param[], bool run);
+void test_slansy(param_value_t param[], bool run);
+void test_slantr(param_value_t param[], bool run);
+void test_slascl(param_value_t param[], bool run);
+void test_slaset(param_value_t param[], bool run);
+void test_sgeswp(param_value_t param[], bool run);
+void test_slauum(param_value_t param[], bool run);
+void test_spbsv(param_value_t param[], bool run);
+void test_spbtrf(param_value_t param[], bool run);
+void test_spoinv(param_value_t param[], bool run);
+void test_sposv(param_value_t param[], bool run);
+void test_sposv_async(param_value_t param[], bool run);
+void test_sposv_batch(param_value_t param[], bool run);
+void test_spotrf(param_value_t param[], bool run);
+void test_spotri(param_value_t param[], bool run);
+void test_spotrs(param_value_t param[], bool run);
+void test_spotrs_handle(param_value_t param[], bool run);
+void test_ssymm(param_value_t param[], bool run);
+void test_sstevx2(param_value_t param[], bool run);
+void test_ssyr2k(param_value_t param[], bool run);
+void test_ssyrk(param_value_t param[], bool run);
+void test_stradd(param_value_t param[], bool run);
+void test_strmm(param_value_t param[], bool run);
+void test_strsm(param_value_t param[], bool run);
+void test_strtri(param_value_t param[], bool run);
+void test_sormlq(param_value_t param[], bool run);
+void test_sormqr(param_value_t param[], bool run);
+
+#endif // TEST_S_H
@@ -0,0 +1,211 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zgeqrf_batch.c, normal z -> s, Sat Oct 17 13:40:27 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "plasma.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @brief Tests SGEQRF_BATCH and its variable size version, factoring
+ *        batch matrices of size m x n and of sizes up to m x n stored at
+ *        a stride of lda*n.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_sgeqrf_batch(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_DIM  ].used = PARAM_USE_M | PARAM_USE_N;
+    param[PARAM_PADA ].used = true;
+    param[PARAM_IB   ].used = true;
+    param[PARAM_BATCH].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int batch = param[PARAM_BATCH].i;
+
+    int lda = imax(1, m + param[PARAM_PADA].i);
+    int minmn = imax(1, imin(m, n));
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaTuning, PlasmaDisabled);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    size_t sizeA = (size_t)lda*n;
+
+    float *A =
+        (float*)malloc(batch*sizeA*sizeof(float));
+    assert(A != NULL);
+
+    float *tau =
+        (float*)malloc(
+            (size_t)batch*minmn*sizeof(float));
+    assert(tau != NULL);
+
+    float **pA =
+        (float**)malloc(batch*sizeof(float*));
+    assert(pA != NULL);
+
+    float **pTau =
+        (float**)malloc(batch*sizeof(float*));
+    assert(pTau != NULL);
+
+    int *ms = (int*)malloc(batch*sizeof(int));
+    assert(ms != NULL);
+
+    int *ns = (int*)malloc(batch*sizeof(int));
+    assert(ns != NULL);
+
+    int *ldas = (int*)malloc(batch*sizeof(int));
+    assert(ldas != NULL);
+
+    float *Aref = NULL;
+    float *tauref = NULL;
+    float *work = NULL;
+    if (test) {
+        Aref = (float*)malloc(
+            batch*sizeA*sizeof(float));
+        assert(Aref != NULL);
+
+        tauref = (float*)malloc(
+            (size_t)minmn*sizeof(float));
+        assert(tauref != NULL);
+
+        work = (float*)malloc((size_t)imax(1, m)*sizeof(float));
+        assert(work != NULL);
+    }
+
+    for (int i = 0; i < batch; i++) {
+        pA[i] = &A[i*sizeA];
+        pTau[i] = &tau[(size_t)i*minmn];
+        // sizes of the variable size batch, up to m x n
+        ms[i] = m > 0 ? 1 + (i*37) % m : 0;
+        ns[i] = n > 0 ? 1 + (i*53) % n : 0;
+        ldas[i] = lda;
+    }
+
+    //================================================================
+    // Run the batch of the same size, then the batch of different
+    // sizes, on the same data.
+    //================================================================
+    param[PARAM_ERROR].d = 0.0;
+    param[PARAM_SUCCESS].i = 1;
+    for (int vbatch = 0; vbatch <= 1; vbatch++) {
+        int seed[] = {0, 0, 0, 1};
+        lapack_int retval;
+        retval = LAPACKE_slarnv(1, seed, batch*sizeA, A);
+        assert(retval == 0);
+
+        if (test)
+            memcpy(Aref, A, batch*sizeA*sizeof(float));
+
+        //============================================================
+        // Run and time PLASMA.
+        //============================================================
+        plasma_time_t start = omp_get_wtime();
+        if (vbatch)
+            plasma_sgeqrf_vbatch(ms, ns, pA, ldas, pTau, batch);
+        else
+            plasma_sgeqrf_batch(m, n, pA, lda, pTau, batch);
+        plasma_time_t stop = omp_get_wtime();
+
+        if (! vbatch) {
+            plasma_time_t time = stop-start;
+            param[PARAM_TIME].d = time;
+            param[PARAM_GFLOPS].d = batch*flops_sgeqrf(m, n) / time / 1e9;
+        }
+
+        //============================================================
+        // Test results by comparing to the LAPACK factorizations,
+        // Householder vectors and R factors.
+        //============================================================
+        if (test) {
+            float zmone = -1.0;
+
+            for (int b = 0; b < batch; b++) {
+                int mb = vbatch ? ms[b] : m;
+                int nb = vbatch ? ns[b] : n;
+                if (mb == 0 || nb == 0)
+                    continue;
+
+                float *Ab = &Aref[b*sizeA];
+                float Anorm = LAPACKE_slange_work(
+                    LAPACK_COL_MAJOR, 'F', mb, nb, Ab, lda, work);
+
+                int lapinfo = LAPACKE_sgeqrf(LAPACK_COL_MAJOR, mb, nb,
+                                             Ab, lda, tauref);
+                assert(lapinfo == 0);
+
+                for (int j = 0; j < nb; j++)
+                    cblas_saxpy(mb, (zmone),
+                                &Ab[(size_t)lda*j], 1,
+                                &pA[b][(size_t)lda*j], 1);
+
+                float error = LAPACKE_slange_work(
+                    LAPACK_COL_MAJOR, 'F', mb, nb, pA[b], lda, work);
+                if (Anorm != 0)
+                    error /= Anorm*nb;
+
+                param[PARAM_ERROR].d = fmax(param[PARAM_ERROR].d, error);
+                param[PARAM_SUCCESS].i &= error < tol;
+            }
+        }
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(tau);
+    free(pA);
+    free(pTau);
+    free(ms);
+    free(ns);
+    free(ldas);
+    if (test) {
+        free(Aref);
+        free(tauref);
+        free(work);
+    }
+}
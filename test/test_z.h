@@ -27,14 +27,19 @@ void test_zgelqf(param_value_t param[], bool run);
 void test_zgelqs(param_value_t param[], bool run);
 void test_zgels(param_value_t param[], bool run);
 void test_zgemm(param_value_t param[], bool run);
+void test_zgemm_batch(param_value_t param[], bool run);
 void test_zgeqrf(param_value_t param[], bool run);
+void test_zgeqrf_batch(param_value_t param[], bool run);
 void test_zgeqrs(param_value_t param[], bool run);
 void test_zgesdd(param_value_t param[], bool run);
 void test_zgesv(param_value_t param[], bool run);
+void test_zgesv_async(param_value_t param[], bool run);
+void test_zgesv_batch(param_value_t param[], bool run);
 void test_zgetrf(param_value_t param[], bool run);
 void test_zgetri(param_value_t param[], bool run);
 void test_zgetri_aux(param_value_t param[], bool run);
 void test_zgetrs(param_value_t param[], bool run);
+void test_zgetrs_handle(param_value_t param[], bool run);
 void test_zhemm(param_value_t param[], bool run);
 void test_zher2k(param_value_t param[], bool run);
 void test_zherk(param_value_t param[], bool run);
@@ -55,9 +60,12 @@ void test_zpbsv(param_value_t param[], bool run);
 void test_zpbtrf(param_value_t param[], bool run);
 void test_zpoinv(param_value_t param[], bool run);
 void test_zposv(param_value_t param[], bool run);
+void test_zposv_async(param_value_t param[], bool run);
+void test_zposv_batch(param_value_t param[], bool run);
 void test_zpotrf(param_value_t param[], bool run);
 void test_zpotri(param_value_t param[], bool run);
 void test_zpotrs(param_value_t param[], bool run);
+void test_zpotrs_handle(param_value_t param[], bool run);
 void test_zsymm(param_value_t param[], bool run);
 void test_zstevx2(param_value_t param[], bool run);
 void test_zsyr2k(param_value_t param[], bool run);
@@ -0,0 +1,267 @@
+#!/usr/bin/env python3
+"""
+Analyzes the task graphs written by plasma_dag_write() after calls made with
+plasma_set(PlasmaDryRun, PlasmaEnabled).
+
+For each graph, estimates the time of every task from its flops and a table
+of kernel rates, then reports:
+
+- the total work and the critical path, and their ratio, the average
+  parallelism;
+- the parallelism available over time, when every task starts as soon as
+  its dependencies are done;
+- the predicted time, speedup and efficiency on a number of cores, by
+  simulating a greedy scheduler that starts the ready tasks by priority,
+  then in the order of their creation.
+
+The rate table is a CSV file with lines of the form
+
+    kernel,gflops[,overhead]
+
+giving the Gflop/s of a kernel on one core and, optionally, a fixed cost
+in microseconds per task. Kernels are matched with or without their
+precision letter, e.g., "gemm" applies to "dgemm" and "zgemm". Kernels
+missing from the table run at --gflops. Rates can be taken from
+plasma_get_stats() on the target machine, or from plasma_bench.
+
+Example:
+
+    ./plasma_dag.py dag.json --rates rates.csv --cores 1,8,32,128
+"""
+
+import argparse
+import csv
+import heapq
+import json
+import sys
+
+
+#-------------------------------------------------------------------------------
+def read_rates(filename):
+    """Returns {kernel: (gflops, overhead in seconds)} from a CSV file."""
+    rates = {}
+    with open(filename) as f:
+        for row in csv.reader(f):
+            if not row or row[0].strip().startswith('#'):
+                continue
+            try:
+                gflops = float(row[1])
+            except (IndexError, ValueError):
+                continue  # header or malformed line
+            overhead = float(row[2])*1e-6 if len(row) > 2 and row[2] else 0.0
+            rates[row[0].strip()] = (gflops, overhead)
+    return rates
+
+
+#-------------------------------------------------------------------------------
+def task_times(graph, rates, gflops, overhead):
+    """Returns the time of each task of the graph, in seconds."""
+    times = []
+    for task in graph['tasks']:
+        kernel = task['kernel']
+        rate, cost = rates.get(kernel, rates.get(kernel[1:],
+                                                 (gflops, overhead)))
+        time = cost
+        if task['flops'] > 0.0:
+            time += task['flops']/(rate*1e9*task['threads'])
+        times.append(time)
+    return times
+
+
+#-------------------------------------------------------------------------------
+def successors(graph):
+    """Returns the successor lists of the tasks of the graph."""
+    succ = [[] for task in graph['tasks']]
+    for task in graph['tasks']:
+        for dep in task['deps']:
+            succ[dep].append(task['id'])
+    return succ
+
+
+#-------------------------------------------------------------------------------
+def critical_path(graph, times):
+    """Returns the earliest start of each task, and the critical path."""
+    start = [0.0]*len(times)
+    finish = 0.0
+    # Tasks come after their dependencies.
+    for task in graph['tasks']:
+        i = task['id']
+        for dep in task['deps']:
+            start[i] = max(start[i], start[dep]+times[dep])
+        finish = max(finish, start[i]+times[i])
+    return start, finish
+
+
+#-------------------------------------------------------------------------------
+def profile(graph, times, start, length, bins):
+    """Returns the average number of busy cores in each of the bins
+    dividing the critical path, when tasks start as early as possible."""
+    busy = [0.0]*bins
+    if length <= 0.0:
+        return busy
+    width = length/bins
+    for task in graph['tasks']:
+        i = task['id']
+        begin, end = start[i], start[i]+times[i]
+        b = min(int(begin/width), bins-1)
+        while b < bins and b*width < end:
+            overlap = min(end, (b+1)*width)-max(begin, b*width)
+            if overlap > 0.0:
+                busy[b] += overlap*task['threads']
+            b += 1
+    return [work/width for work in busy]
+
+
+#-------------------------------------------------------------------------------
+def simulate(graph, times, succ, cores):
+    """Returns the time of the graph on the cores, scheduling the ready
+    tasks by priority, then in the order of their creation.
+    A task running on several threads takes as many cores, at most all."""
+    tasks = graph['tasks']
+    num_deps = [len(task['deps']) for task in tasks]
+    ready = [(-task['priority'], task['id']) for task in tasks
+             if num_deps[task['id']] == 0]
+    heapq.heapify(ready)
+    running = []
+    free = cores
+    now = 0.0
+    while ready or running:
+        # Start the first ready tasks while they fit.
+        while ready:
+            i = ready[0][1]
+            threads = min(tasks[i]['threads'], cores)
+            if threads > free:
+                break
+            heapq.heappop(ready)
+            free -= threads
+            # Fewer threads than requested take proportionally longer.
+            time = times[i]*tasks[i]['threads']/threads
+            heapq.heappush(running, (now+time, i, threads))
+
+        now, i, threads = heapq.heappop(running)
+        free += threads
+        for s in succ[i]:
+            num_deps[s] -= 1
+            if num_deps[s] == 0:
+                heapq.heappush(ready, (-tasks[s]['priority'], s))
+    return now
+
+
+#-------------------------------------------------------------------------------
+def analyze(graph, rates, args):
+    """Returns the analysis of one graph as a dictionary."""
+    times = task_times(graph, rates, args.gflops, args.overhead*1e-6)
+    succ = successors(graph)
+    start, length = critical_path(graph, times)
+    work = sum(time*task['threads']
+               for time, task in zip(times, graph['tasks']))
+    flops = sum(task['flops'] for task in graph['tasks'])
+
+    kernels = {}
+    for time, task in zip(times, graph['tasks']):
+        kernel = kernels.setdefault(task['kernel'], {'tasks': 0, 'time': 0.0})
+        kernel['tasks'] += 1
+        kernel['time'] += time*task['threads']
+
+    result = {
+        'routine': graph['routine'],
+        'm': graph['m'], 'n': graph['n'],
+        'nb': graph['nb'], 'ib': graph['ib'],
+        'tasks': len(graph['tasks']),
+        'flops': flops,
+        'work': work,
+        'critical_path': length,
+        'parallelism': work/length if length > 0.0 else 0.0,
+        'kernels': kernels,
+        'profile': profile(graph, times, start, length, args.bins),
+        'cores': [],
+    }
+    for cores in args.cores:
+        time = simulate(graph, times, succ, cores)
+        speedup = work/time if time > 0.0 else 0.0
+        result['cores'].append({
+            'cores': cores,
+            'time': time,
+            'speedup': speedup,
+            'efficiency': speedup/cores,
+            'gflops': flops/time/1e9 if time > 0.0 else 0.0,
+        })
+    return result
+
+
+#-------------------------------------------------------------------------------
+def print_text(result, out):
+    print('%s  m %d  n %d  nb %d  ib %d'
+          % (result['routine'], result['m'], result['n'],
+             result['nb'], result['ib']), file=out)
+    print('  tasks %d, work %.4g s, critical path %.4g s, '
+          'average parallelism %.1f'
+          % (result['tasks'], result['work'], result['critical_path'],
+             result['parallelism']), file=out)
+
+    print('  %-10s %10s %12s' % ('kernel', 'tasks', 'work (s)'), file=out)
+    for name, kernel in sorted(result['kernels'].items(),
+                               key=lambda item: -item[1]['time']):
+        print('  %-10s %10d %12.4g' % (name, kernel['tasks'],
+                                       kernel['time']), file=out)
+
+    print('  parallelism over the critical path:', file=out)
+    bins = result['profile']
+    peak = max(bins) if bins else 0.0
+    for b, busy in enumerate(bins):
+        bar = '#'*int(round(40*busy/peak)) if peak > 0.0 else ''
+        print('  %3d%% %8.1f %s' % (100*b//len(bins), busy, bar), file=out)
+
+    print('  %8s %12s %10s %10s %10s'
+          % ('cores', 'time (s)', 'speedup', 'efficiency', 'Gflop/s'),
+          file=out)
+    for row in result['cores']:
+        print('  %8d %12.4g %10.2f %10.2f %10.1f'
+              % (row['cores'], row['time'], row['speedup'],
+                 row['efficiency'], row['gflops']), file=out)
+    print(file=out)
+
+
+#-------------------------------------------------------------------------------
+def main():
+    parser = argparse.ArgumentParser(
+        description='Critical path, parallelism and predicted speedups '
+                    'of PLASMA task graphs written by plasma_dag_write().')
+    parser.add_argument('filename', help='JSON file of task graphs')
+    parser.add_argument('--rates', help='CSV file of kernel,gflops[,overhead]')
+    parser.add_argument('--gflops', type=float, default=10.0,
+                        help='Gflop/s of one core for kernels not in the '
+                             'rate table (default 10)')
+    parser.add_argument('--overhead', type=float, default=1.0,
+                        help='microseconds of every task for kernels not in '
+                             'the rate table (default 1)')
+    parser.add_argument('--cores', default='1,2,4,8,16,32,64,128',
+                        help='comma separated core counts to simulate')
+    parser.add_argument('--bins', type=int, default=10,
+                        help='number of intervals of the parallelism profile')
+    parser.add_argument('--json', action='store_true',
+                        help='print the results as JSON')
+    args = parser.parse_args()
+
+    try:
+        args.cores = [int(c) for c in args.cores.split(',')]
+    except ValueError:
+        parser.error('invalid --cores')
+    if min(args.cores) < 1 or args.bins < 1 or args.gflops <= 0.0:
+        parser.error('--cores, --bins and --gflops must be positive')
+
+    with open(args.filename) as f:
+        graphs = json.load(f)['graphs']
+    rates = read_rates(args.rates) if args.rates else {}
+
+    results = [analyze(graph, rates, args) for graph in graphs]
+    if args.json:
+        json.dump({'graphs': results}, sys.stdout, indent=2)
+        print()
+    else:
+        for result in results:
+            print_text(result, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
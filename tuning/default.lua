@@ -44,6 +44,10 @@ function gemm_nb (type, num_threads, m, n, k)
         return 256
 end
 
+function gemm_small (type, num_threads, m, n, k)
+        return 256
+end
+
 --------------------------------------------------------------------------------
 function geqrf_nb (type, num_threads, m, n)
         return 256
@@ -71,6 +75,10 @@ function getrf_max_panel_threads (type, num_threads, m, n)
 	return 1
 end
 
+function getrf_small (type, num_threads, m, n)
+	return 256
+end
+
 --------------------------------------------------------------------------------
 function hetrf_nb (type, num_threads, n)
         return 256
@@ -126,6 +134,10 @@ function potrf_nb (type, num_threads, n)
         return 256
 end
 
+function potrf_small (type, num_threads, n)
+        return 256
+end
+
 --------------------------------------------------------------------------------
 function poinv_nb (type, num_threads, n)
         return 256